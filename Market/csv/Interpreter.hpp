@@ -12,16 +12,19 @@
 #include <vector>
 
 #include "Reader.hpp"
+#include "MappedReader.hpp"
 
 namespace mkt {
 namespace csv {
 
-template <typename Schema, char delim = ','>
+// Source is Reader or MappedReader; the latter hands Schema::from a
+// vector of string_views instead of strings.
+template <typename Schema, char delim = ',', typename Source = Reader<delim>>
 class Interpreter {
-    Reader<delim> reader;
-    std::vector<std::string> values;
+    Source & reader;
+    typename Source::Values values;
 public:
-    Interpreter(Reader<delim> & reader): reader(reader) {}
+    Interpreter(Source & reader): reader(reader) {}
     
     bool get_next(Schema & row) {
         if (!reader.read_next_line(values)) {
@@ -31,7 +34,7 @@ public:
         return row.from(values);
     }
     
-    std::vector<std::string> get_headers() const {
+    const typename Source::Values & get_headers() const {
         return reader.get_headers();
     }
 };
@@ -0,0 +1,58 @@
+//
+//  MappedReader.hpp
+//  Market
+//
+//  Created by Blagovest on 18/12/20.
+//
+
+#ifndef Csv_MappedReader_hpp
+#define Csv_MappedReader_hpp
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Scanner.hpp"
+#include "../util/MappedFile.hpp"
+
+namespace mkt {
+namespace csv {
+
+// Same interface as Reader, but over a memory mapped file: the values are
+// string_views into the mapping, so nothing is copied and the vector is
+// reused row after row. They stay valid as long as the reader does, except
+// for unescaped ones, which only last until the next line is read.
+// Lines are split by scanner::Tokenizer, so values may be quoted and lines
+// may end in \r\n. Unlike Reader, empty values are kept so columns never shift.
+template <char delim = ','>
+class MappedReader {
+    util::MappedFile file;
+    scanner::Tokenizer<delim> tokenizer;
+    std::vector<std::string_view> headers;
+    std::vector<std::string> names;     // what headers point to
+
+public:
+    using Values = std::vector<std::string_view>;
+    
+    MappedReader(const char * path, util::MappedFile::Access access = util::MappedFile::Access::SEQUENTIAL): file(path, access), tokenizer(file.view()), headers(), names() {
+        // first line is assumed to be the headers, copied so an unescaped
+        // one outlives the next line
+        read_next_line(headers);
+        names.assign(headers.begin(), headers.end());
+        headers.assign(names.begin(), names.end());
+    }
+    
+    bool read_next_line(Values & values) {
+        return tokenizer.read_next_line(values);
+    }
+    
+    const Values & get_headers() const noexcept { return headers; }
+    
+    // whether the file could be mapped, see errno otherwise
+    explicit operator bool() const noexcept { return static_cast<bool>(file); }
+};
+
+}
+}
+
+#endif /* MappedReader_hpp */
@@ -0,0 +1,232 @@
+//
+//  ParallelInterpreter.hpp
+//  Market
+//
+//  Created by Blagovest on 20/12/20.
+//
+
+#ifndef Csv_ParallelInterpreter_hpp
+#define Csv_ParallelInterpreter_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Scanner.hpp"
+#include "../util/MappedFile.hpp"
+
+namespace mkt {
+namespace csv {
+
+// Interpreter for big files: the mapped file is cut into chunks at line
+// boundaries and the chunks tokenized and converted to Schema rows on a
+// set of worker threads. Rows come either one by one in file order, with
+// at most window() chunks converted ahead of the consumer, or a chunk at a
+// time in whatever order the workers finish, on the workers themselves.
+//
+// Chunks are cut at the first newline past each chunk_size bytes, so a
+// quoted value must not hold a newline. Rows that Schema::from rejects or
+// throws on are skipped and counted in rejected().
+template <typename Schema, char delim = ','>
+class ParallelInterpreter {
+    struct Chunk {
+        size_t begin, end;
+        std::vector<Schema> rows;
+        size_t rejected;
+        bool done;
+    };
+    
+    util::MappedFile file;
+    std::vector<std::string_view> headers;
+    std::vector<std::string> names;     // what headers point to
+    std::vector<Chunk> chunks;
+    unsigned threads;
+    std::atomic<size_t> _rejected;
+    
+    void split(size_t begin, size_t chunk_size) {
+        auto data = file.data();
+        auto size = file.size();
+        
+        while (begin < size) {
+            auto end = std::min(size, begin + chunk_size);
+            if (end < size) {
+                auto newline = static_cast<const char *>(std::memchr(data + end, '\n', size - end));
+                end = newline ? newline - data + 1 : size;
+            }
+            chunks.push_back(Chunk { begin, end, {}, 0, false });
+            begin = end;
+        }
+    }
+    
+    void convert(Chunk & chunk) {
+        scanner::Tokenizer<delim> tokenizer (file.data() + chunk.begin, chunk.end - chunk.begin);
+        std::vector<std::string_view> values;
+        Schema row;
+        
+        while (tokenizer.read_next_line(values)) {
+            bool ok = false;
+            try {
+                ok = row.from(values);
+            } catch (...) {}
+            
+            if (ok) {
+                chunk.rows.push_back(row);
+            } else {
+                ++chunk.rejected;
+            }
+        }
+        
+        _rejected += chunk.rejected;
+    }
+    
+    template <typename Work>
+    std::vector<std::thread> start(Work && work) {
+        // a run converts every chunk afresh
+        for (auto & chunk : chunks) {
+            // left behind if the last run was stopped by a throwing consumer
+            chunk.rows.clear();
+            chunk.rejected = 0;
+            chunk.done = false;
+        }
+        _rejected = 0;
+        
+        std::vector<std::thread> workers;
+        for (unsigned i = 0; i < threads; ++i) {
+            workers.emplace_back(work);
+        }
+        return workers;
+    }
+    
+    static void join(std::vector<std::thread> & workers) {
+        for (auto & worker : workers) {
+            worker.join();
+        }
+    }
+
+public:
+    ParallelInterpreter(const char * path, unsigned threads = std::thread::hardware_concurrency(), size_t chunk_size = 4 << 20):
+        file(path, util::MappedFile::Access::SEQUENTIAL), headers(), names(), chunks(), threads(std::max(1u, threads)), _rejected() {
+        // first line is assumed to be the headers, copied so an unescaped
+        // one outlives the tokenizer
+        scanner::Tokenizer<delim> tokenizer (file.view());
+        tokenizer.read_next_line(headers);
+        names.assign(headers.begin(), headers.end());
+        headers.assign(names.begin(), names.end());
+        split(tokenizer.position(), std::max<size_t>(chunk_size, 1));
+    }
+    
+    // Calls consumer(row) for every row, in file order, on this thread.
+    // If consumer throws, the workers stop and are joined before it's rethrown.
+    template <typename Consumer>
+    void for_each(Consumer && consumer) {
+        std::mutex mutex;
+        std::condition_variable changed;
+        size_t next = 0, consumed = 0;
+        
+        // hands out no more chunks and joins the workers, however we leave
+        struct Stop {
+            std::mutex & mutex;
+            std::condition_variable & changed;
+            size_t & next;
+            size_t end;
+            std::vector<std::thread> workers;
+            
+            ~Stop() {
+                {
+                    std::lock_guard lock (mutex);
+                    next = end;
+                }
+                changed.notify_all();
+                join(workers);
+            }
+        };
+        
+        Stop stop { mutex, changed, next, chunks.size(), start([&] {
+            while (true) {
+                std::unique_lock lock (mutex);
+                changed.wait(lock, [&] { return next == chunks.size() || next < consumed + window(); });
+                if (next == chunks.size()) {
+                    return;
+                }
+                auto & chunk = chunks[next++];
+                lock.unlock();
+                
+                convert(chunk);
+                
+                lock.lock();
+                chunk.done = true;
+                changed.notify_all();
+            }
+        }) };
+        
+        for (auto & chunk : chunks) {
+            {
+                std::unique_lock lock (mutex);
+                changed.wait(lock, [&] { return chunk.done; });
+            }
+            
+            for (auto & row : chunk.rows) {
+                consumer(row);
+            }
+            // done with it, let the workers run further ahead
+            std::vector<Schema>().swap(chunk.rows);
+            
+            std::lock_guard lock (mutex);
+            ++consumed;
+            changed.notify_all();
+        }
+    }
+    
+    // Calls consumer(index, rows) for every chunk as soon as it's converted,
+    // concurrently on the worker threads; index is the chunk's place in the
+    // file, rows the chunk's rows in file order, the consumer's to keep.
+    // If consumer throws, no more chunks are started and the first
+    // exception is rethrown here once the workers are done.
+    template <typename Consumer>
+    void for_each_batch(Consumer && consumer) {
+        std::atomic<size_t> next = 0;
+        std::mutex mutex;
+        std::exception_ptr error;
+        
+        auto workers = start([&] {
+            try {
+                for (size_t i; (i = next++) < chunks.size(); ) {
+                    convert(chunks[i]);
+                    consumer(i, chunks[i].rows);
+                    std::vector<Schema>().swap(chunks[i].rows);
+                }
+            } catch (...) {
+                next = chunks.size();
+                std::lock_guard lock (mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        });
+        join(workers);
+        
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    
+    const std::vector<std::string_view> & get_headers() const noexcept { return headers; }
+    size_t size() const noexcept { return chunks.size(); }
+    size_t window() const noexcept { return 2 * threads; }
+    size_t rejected() const noexcept { return _rejected; }
+    
+    // whether the file could be mapped, see errno otherwise
+    explicit operator bool() const noexcept { return static_cast<bool>(file); }
+};
+
+}
+}
+
+#endif /* ParallelInterpreter_hpp */
@@ -23,6 +23,8 @@ class Reader {
     std::vector<std::string> headers;
     
 public:
+    using Values = std::vector<std::string>;
+    
     Reader(std::istream& in): parser(in), headers() {
         // first line is assumed to be the headers
         read_next_line(headers);
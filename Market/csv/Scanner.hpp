@@ -0,0 +1,256 @@
+//
+//  Scanner.hpp
+//  Market
+//
+//  Created by Blagovest on 19/12/20.
+//
+
+#ifndef Csv_Scanner_hpp
+#define Csv_Scanner_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Parser.hpp"
+#include "../util/Cpu.hpp"
+
+namespace mkt {
+namespace csv {
+namespace scanner {
+
+    // quote, delimiter and newline bitmasks of one 64 byte block
+    struct Block {
+        uint64_t quote;
+        uint64_t delim;
+        uint64_t newline;
+    };
+
+    constexpr size_t block_size = 64;
+
+    template <char delim>
+    struct ScalarKernel {
+        static Block block(const char * data) noexcept {
+            Block block { 0, 0, 0 };
+            
+            for (size_t i = 0; i < block_size; ++i) {
+                block.quote |= uint64_t(data[i] == '"') << i;
+                block.delim |= uint64_t(data[i] == delim) << i;
+                block.newline |= uint64_t(data[i] == '\n') << i;
+            }
+            
+            return block;
+        }
+    };
+
+#ifdef MKT_X86
+    template <char delim>
+    struct Sse2Kernel {
+        __attribute__((target("sse2")))
+        static uint64_t mask(const char * data, char c) noexcept {
+            auto match = _mm_set1_epi8(c);
+            uint64_t mask = 0;
+            for (size_t i = 0; i < block_size; i += 16) {
+                auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+                mask |= uint64_t(uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, match)))) << i;
+            }
+            return mask;
+        }
+        
+        __attribute__((target("sse2")))
+        static Block block(const char * data) noexcept {
+            return Block { mask(data, '"'), mask(data, delim), mask(data, '\n') };
+        }
+    };
+
+    template <char delim>
+    struct Avx2Kernel {
+        __attribute__((target("avx2")))
+        static uint64_t mask(__m256i lo, __m256i hi, char c) noexcept {
+            auto match = _mm256_set1_epi8(c);
+            return uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, match))))
+                | uint64_t(uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, match)))) << 32;
+        }
+        
+        __attribute__((target("avx2")))
+        static Block block(const char * data) noexcept {
+            auto lo = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+            auto hi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 32));
+            return Block { mask(lo, hi, '"'), mask(lo, hi, delim), mask(lo, hi, '\n') };
+        }
+    };
+#endif
+
+    // bit i set if an odd number of bits up to and including i are
+    inline uint64_t prefix_xor(uint64_t bits) noexcept {
+        bits ^= bits << 1;
+        bits ^= bits << 2;
+        bits ^= bits << 4;
+        bits ^= bits << 8;
+        bits ^= bits << 16;
+        bits ^= bits << 32;
+        return bits;
+    }
+
+    // Splits a CSV buffer into values the way Parser does, a block of 64
+    // bytes at a time: delimiters and newlines are found for the whole
+    // block at once, and the ones between quotes masked away, so values may
+    // be quoted and hold delimiters and newlines. A quoted value comes back
+    // without its quotes; one with a doubled "" inside comes back unescaped,
+    // as a copy the tokenizer owns until the next line is started, while
+    // every other value points into the buffer itself.
+    // A \r before a newline is dropped from the line's last value.
+    template <char delim = ','>
+    class Tokenizer {
+        using Context = typename Parser<delim>::Context;
+        using Kernel = Block (*)(const char *) noexcept;
+        
+        const char * data;
+        size_t size;
+        Kernel kernel;
+        
+        size_t base;      // of the current block
+        size_t start;     // of the next value
+        uint64_t bits;    // delimiters and newlines left in the block
+        uint64_t newline;
+        uint64_t inside;  // all ones if the last block ended between quotes
+        bool open;        // the last value ended in a delimiter, one more follows
+        bool quoted;      // the last value was
+        
+        // unescaped copies of the current line's values, reused line after line
+        std::vector<std::unique_ptr<std::string>> escaped;
+        size_t escapes;
+        
+        static Kernel pick() noexcept {
+            switch (util::isa()) {
+#ifdef MKT_X86
+                case util::Isa::AVX2: return &Avx2Kernel<delim>::block;
+                case util::Isa::SSE2: return &Sse2Kernel<delim>::block;
+#endif
+                default: return &ScalarKernel<delim>::block;
+            }
+        }
+        
+        void load() noexcept {
+            Block block;
+            if (base + block_size <= size) {
+                block = kernel(data + base);
+            } else {
+                // zero padding is neither of the three
+                char tail[block_size] = {};
+                std::memcpy(tail, data + base, size - base);
+                block = kernel(tail);
+            }
+            
+            auto quoted = prefix_xor(block.quote) ^ inside;
+            inside = static_cast<uint64_t>(-static_cast<int64_t>(quoted >> 63));
+            newline = block.newline & ~quoted;
+            bits = (block.delim | block.newline) & ~quoted;
+        }
+        
+        std::string_view value(size_t end, bool line_end) {
+            auto begin = start;
+            if (line_end && end > begin && data[end - 1] == '\r') {
+                --end;
+            }
+            quoted = end - begin >= 2 && data[begin] == '"' && data[end - 1] == '"';
+            if (!quoted) {
+                return std::string_view(data + begin, end - begin);
+            }
+            
+            auto first = data + begin + 1, last = data + end - 1;
+            auto quote = static_cast<const char *>(std::memchr(first, '"', last - first));
+            return quote ? unescape(first, quote, last) : std::string_view(first, last - first);
+        }
+        
+        // [first, last) with every "" as one quote, quote being the first
+        __attribute__((noinline))
+        std::string_view unescape(const char * first, const char * quote, const char * last) {
+            if (escapes == escaped.size()) {
+                escaped.push_back(std::make_unique<std::string>());
+            }
+            auto & copy = *escaped[escapes++];
+            copy.assign(first, quote);
+            for (auto it = quote; it != last; ++it) {
+                copy.push_back(*it);
+                it += *it == '"' && it + 1 != last && it[1] == '"';
+            }
+            return copy;
+        }
+    public:
+        Tokenizer(const char * data, size_t size) noexcept: data(data), size(size), kernel(pick()), base(0), start(0), bits(0), newline(0), inside(0), open(false), quoted(false), escaped(), escapes(0) {
+            if (size) {
+                load();
+            }
+        }
+        
+        Tokenizer(std::string_view buffer) noexcept: Tokenizer(buffer.data(), buffer.size()) {}
+        
+        // the next value and whether it ends a line, FILE_END once all's read
+        Context get_next_token(std::string_view & token) {
+            if (!open) {
+                // a new line, the last one's copies can go
+                escapes = 0;
+            }
+            
+            while (!bits) {
+                if (base + block_size >= size) {
+                    if (start >= size && !open) {
+                        token = {};
+                        quoted = false;
+                        return Context::FILE_END;
+                    }
+                    // the last line without a newline, maybe just the
+                    // empty value after a trailing delimiter
+                    token = value(size, true);
+                    start = size;
+                    open = false;
+                    return Context::LINE_END;
+                }
+                base += block_size;
+                load();
+            }
+            
+            auto i = static_cast<unsigned>(__builtin_ctzll(bits));
+            bits &= bits - 1;
+            
+            auto line_end = newline >> i & 1;
+            token = value(base + i, line_end);
+            start = base + i + 1;
+            open = !line_end;
+            return line_end ? Context::LINE_END : Context::MIDDLE_VALUE;
+        }
+        
+        // all values of the next non blank line, false at the end; a line
+        // of just "" isn't blank, it's one empty value
+        bool read_next_line(std::vector<std::string_view> & values) {
+            std::string_view token;
+            Context context;
+            
+            do {
+                values.clear();
+                
+                do {
+                    context = get_next_token(token);
+                    if (context != Context::FILE_END) {
+                        values.push_back(token);
+                    }
+                } while (context == Context::MIDDLE_VALUE);
+            } while (context != Context::FILE_END && values.size() == 1 && values[0].empty() && !quoted);
+            
+            return !values.empty();
+        }
+        
+        // where the next value starts
+        size_t position() const noexcept { return start; }
+    };
+
+}
+}
+}
+
+#endif /* Scanner_hpp */
@@ -10,8 +10,18 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <array>
+#include <bitset>
+#include <limits>
+#include <stdexcept>
 #include <chrono>
+#include <charconv>
+#include <type_traits>
+#include <utility>
+
+#include "../util/FixedPrice.hpp"
 
 namespace mkt {
 namespace csv {
@@ -19,56 +29,173 @@ namespace schema {
 
     struct Raw {
         std::vector<std::string> values;
-        bool from(const std::vector<std::string> & values) noexcept { this->values = values; return true; }
+        
+        template <typename Values>
+        bool from(const Values & values) noexcept {
+            this->values.assign(values.begin(), values.end());
+            return true;
+        }
+    };
+
+    // Parser<T>::parse(value, result) converts one value, false if it can't;
+    // nothing throws and nothing is copied but strings.
+    template <typename T>
+    struct DefaultParser;
+
+    template <typename Integer>
+    struct IntegralParser {
+        static bool parse(std::string_view value, Integer & result) noexcept {
+            auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+            return error == std::errc() && end == value.data() + value.size();
+        }
+    };
+
+    template <> struct DefaultParser<int>: IntegralParser<int> {};
+    template <> struct DefaultParser<long>: IntegralParser<long> {};
+    template <> struct DefaultParser<long long>: IntegralParser<long long> {};
+    template <> struct DefaultParser<unsigned>: IntegralParser<unsigned> {};
+    template <> struct DefaultParser<unsigned long>: IntegralParser<unsigned long> {};
+    template <> struct DefaultParser<unsigned long long>: IntegralParser<unsigned long long> {};
+
+    template <unsigned Decimals, typename Rep>
+    struct DefaultParser<util::FixedPrice<Decimals, Rep>> {
+        static bool parse(std::string_view value, util::FixedPrice<Decimals, Rep> & result) noexcept {
+            auto [end, error] = util::from_chars(value.data(), value.data() + value.size(), result);
+            return error == std::errc() && end == value.data() + value.size();
+        }
     };
-    
+
+    template <>
+    struct DefaultParser<char> {
+        static bool parse(std::string_view value, char & result) noexcept {
+            result = value.empty() ? '\0' : value[0];
+            return value.size() <= 1;
+        }
+    };
+
+    template <>
+    struct DefaultParser<std::string> {
+        static bool parse(std::string_view value, std::string & result) {
+            result = value;
+            return true;
+        }
+    };
+
+    // only as long lived as the values, e.g. those of a MappedReader
+    template <>
+    struct DefaultParser<std::string_view> {
+        static bool parse(std::string_view value, std::string_view & result) noexcept {
+            result = value;
+            return true;
+        }
+    };
+
+    // The i-th value into the i-th element, for Reader's or MappedReader's values.
     template <template <typename> typename Parser, typename... Args>
     class CustomizableTuple {
-        template <int i>
-        bool set(const std::vector<std::string> & values) {
-            if constexpr (i == sizeof...(Args)) {
-                return true;
-            }
-            
-            try {
-                using ith = typename std::tuple_element<i, decltype(tuple)>::type;
-                std::get<i>(tuple) = Parser<ith>(values[i]);
-                set<i + 1>(values);
-            } catch (...) {
-                return false;
-            }
+        template <size_t... i, typename Values>
+        bool set(std::index_sequence<i...>, const Values & values) {
+            return (Parser<Args>::parse(values[i], std::get<i>(tuple)) && ...);
         }
     public:
         std::tuple<Args...> tuple;
         
-        bool from(const std::vector<std::string> & values) noexcept {
+        template <typename Values>
+        bool from(const Values & values) {
             if (values.size() != sizeof...(Args)) {
                 return false;
             }
             
-            return set<0>(values);
+            return set(std::index_sequence_for<Args...>(), values);
         }
     };
-    
-    template <typename T>
-    struct DefaultParser;
-    
-    template <>
-    struct DefaultParser<int> {
-        static int parse(const std::string & value) {
-            return std::stoi(value);
+
+    template <typename... Args>
+    using Tuple = CustomizableTuple<DefaultParser, Args...>;
+
+    // Binds columns to members of Struct at compile time, e.g.
+    //
+    //     Binding<Quote, &Quote::symbol, &Quote::bid, &Quote::ask> binding ({ "EventSymbol", "BidPrice", "AskPrice" }, reader.get_headers());
+    //
+    // Column positions are looked up by header name once, when the binding
+    // is made; from() then converts straight from the values into the
+    // members. Skipped members are left alone and their values never looked
+    // at; a name that isn't among the headers throws std::invalid_argument,
+    // so skip the member if its column is optional.
+    template <template <typename> typename Parser, typename Struct, auto... Members>
+    class CustomizableBinding {
+        static constexpr size_t size = sizeof...(Members);
+        static constexpr size_t npos = std::numeric_limits<size_t>::max();
+        static constexpr auto members = std::make_tuple(Members...);
+        
+        template <size_t i>
+        using member_type = std::remove_reference_t<decltype(std::declval<Struct &>().*std::get<i>(members))>;
+        
+        std::array<size_t, size> columns;
+        size_t width; // values a row needs
+        
+        template <size_t i, typename Values>
+        bool set(const Values & values, Struct & row) const {
+            return columns[i] == npos || Parser<member_type<i>>::parse(values[columns[i]], row.*std::get<i>(members));
         }
-    };
-    
-    template <>
-    struct DefaultParser<std::string> {
-        static std::string parse(const std::string & value) noexcept {
-            return value;
+        
+        template <size_t... i, typename Values>
+        bool set(std::index_sequence<i...>, const Values & values, Struct & row) const {
+            return (set<i>(values, row) && ...);
+        }
+        
+        void measure() {
+            width = 0;
+            for (auto column : columns) {
+                if (column != npos) {
+                    width = std::max(width, column + 1);
+                }
+            }
+        }
+    public:
+        using Mask = std::bitset<size>;
+        
+        // member i is column i, unless skipped
+        explicit CustomizableBinding(Mask skip = Mask()) {
+            for (size_t i = 0; i < size; ++i) {
+                columns[i] = skip[i] ? npos : i;
+            }
+            measure();
+        }
+        
+        // member i is the column headed names[i], unless skipped; throws
+        // std::invalid_argument for the first name no header matches
+        template <typename Headers>
+        CustomizableBinding(const std::array<std::string_view, size> & names, const Headers & headers, Mask skip = Mask()) {
+            for (size_t i = 0; i < size; ++i) {
+                columns[i] = npos;
+                for (size_t column = 0; !skip[i] && column < headers.size(); ++column) {
+                    if (std::string_view(headers[column]) == names[i]) {
+                        columns[i] = column;
+                        break;
+                    }
+                }
+                if (!skip[i] && columns[i] == npos) {
+                    throw std::invalid_argument("no column " + std::string(names[i]));
+                }
+            }
+            measure();
+        }
+        
+        // the column member i comes from, npos if none
+        size_t column(size_t member) const noexcept { return columns[member]; }
+        bool bound(size_t member) const noexcept { return columns[member] != npos; }
+        
+        // false if the row is too short or a value doesn't convert, in which
+        // case the members before it are already set
+        template <typename Values>
+        bool from(const Values & values, Struct & row) const {
+            return values.size() >= width && set(std::make_index_sequence<size>(), values, row);
         }
     };
-    
-    template <typename... Args>
-    using Tuple = CustomizableTuple<DefaultParser, Args...>;
+
+    template <typename Struct, auto... Members>
+    using Binding = CustomizableBinding<DefaultParser, Struct, Members...>;
 
 }
 }
@@ -6,73 +6,159 @@
 //
 
 #include <iomanip>
-#include <ctime>
 #include <iostream>
+#include <charconv>
+#include <stdexcept>
 
 #include "Move.hpp"
+#include "../util/Time.hpp"
 
 namespace mkt {
 namespace equity {
 
-std::chrono::time_point<Move::clock> Move::parse_date(const std::string & value) {
-    // parses stuff like 20190806-150007-0500
+std::chrono::time_point<Move::clock> Move::parse_date(std::string_view value) {
+    // parses stuff like 20190806-150007-0500 or 20190806-185959.999-0500,
+    // the offset being optional and UTC without it
     
-    using std::chrono::duration_cast;
+    using util::digits;
+    using util::all_digits;
     
-    tm t{};
+    // midnight of the last date seen, per thread so parallel readers don't share it
+    thread_local util::CivilDayCache days;
     
-    t.tm_year = ord(value[0], 1000) + ord(value[1], 100) + ord(value[2], 10) + ord(value[3]) - 1900;
-    t.tm_mon = ord(value[4], 10) + ord(value[5]) - 1;
-    t.tm_mday = ord(value[6], 10) + ord(value[7]);
+    auto data = value.data();
+    auto size = static_cast<unsigned>(value.size());
     
-    t.tm_hour = ord(value[9], 10) + ord(value[10]);
-    t.tm_min = ord(value[11], 10) + ord(value[12]);
-    t.tm_sec = ord(value[13], 10) + ord(value[14]);
+    if (size < 15 || data[8] != '-' || !all_digits(data, 8) || !all_digits(data + 9, 6)) {
+        throw std::invalid_argument("bad value " + std::string(value));
+    }
+    
+    int64_t seconds = days(data) * 86400 + digits(data + 9, 2) * 3600 + digits(data + 11, 2) * 60 + digits(data + 13, 2);
+    int64_t nanos = 0;
+    unsigned i = 15;
     
-    long long millis = 0;
+    if (i < size && data[i] == '.') {
+        unsigned fraction = 0;
+        while (++i < size && data[i] >= '0' && data[i] <= '9') {
+            if (fraction++ < 9) {
+                nanos = 10 * nanos + (data[i] - '0');
+            }
+        }
+        for (; fraction < 9; ++fraction) {
+            nanos *= 10;
+        }
+    }
     
-    if (value[15] == '.') {
-        millis = ord(value[16], 100) + ord(value[17], 10) + ord(value[18]);
-    } else if (value[15] != '-') {
-        throw new std::invalid_argument("bad value" + value);
+    if (i < size) {
+        if (size - i != 5 || (data[i] != '-' && data[i] != '+') || !all_digits(data + i + 1, 4)) {
+            throw std::invalid_argument("bad value " + std::string(value));
+        }
+        // local time is UTC plus the offset
+        auto offset = static_cast<int64_t>(digits(data + i + 1, 2) * 3600 + digits(data + i + 3, 2) * 60);
+        seconds -= data[i] == '-' ? -offset : offset;
     }
+    
+    return std::chrono::time_point<clock>(std::chrono::duration_cast<clock::duration>(std::chrono::nanoseconds(seconds * 1000000000 + nanos)));
+}
 
-    time_t time = mktime(&t);
+unsigned Move::parse_count(std::string_view value) {
+    unsigned count;
+    auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), count);
     
-    return clock::from_time_t(time) + std::chrono::milliseconds(millis);
+    if (error != std::errc() || end != value.data() + value.size()) {
+        throw std::invalid_argument("bad count " + std::string(value));
+    }
+    
+    return count;
 }
 
-bool Move::from(const std::vector<std::string> & values) {
+template <typename Values>
+bool Move::check(const Values & values) {
     if (values.size() != Field::COUNT && values.size() + 1 != Field::COUNT) {
         std::cerr << "[EquityMove] Unexpected number of fields: " << values.size() << " (expected: " << Field::COUNT << " (or 1 fewer), was " << values.size() << ")" << std::endl;
         return false;
     }
-    // MarketMaker,EventSymbol,EventTime,ExchangeCode,MarketMaker,BidTime,BidPrice,BidSize,BidCount,AskTime,AskPrice,AskSize,AskCount
-    event.symbol = values[Field::EVENT_SYMBOL];
-    event.time = parse_date(values[Field::EVENT_TIME]);
+    return true;
+}
+
+template <typename Values, typename Target>
+void Move::assign_sides(const Values & values, Target & target) {
+    target.event.time = parse_date(values[Field::EVENT_TIME]);
     
-    bid.time = parse_date(values[Field::BID_TIME]);
-    bid.count = std::stoi(values[Field::BID_COUNT]);
-    bid.price = std::stold(values[Field::BID_PRICE]);
-    bid.size = std::stoi(values[Field::BID_SIZE]);
+    target.bid.time = parse_date(values[Field::BID_TIME]);
+    target.bid.count = parse_count(values[Field::BID_COUNT]);
+    target.bid.price = Price::parse(values[Field::BID_PRICE]);
+    target.bid.size = parse_count(values[Field::BID_SIZE]);
     
-    ask.time = parse_date(values[Field::ASK_TIME]);
-    ask.count = std::stoi(values[Field::ASK_COUNT]);
-    ask.price = std::stold(values[Field::ASK_PRICE]);
-    ask.size = std::stoi(values[Field::ASK_SIZE]);
+    target.ask.time = parse_date(values[Field::ASK_TIME]);
+    target.ask.count = parse_count(values[Field::ASK_COUNT]);
+    target.ask.price = Price::parse(values[Field::ASK_PRICE]);
+    target.ask.size = parse_count(values[Field::ASK_SIZE]);
     
-    market.xcode = values[Field::EXCHANGE_CODE][0];
+    if (values[Field::EXCHANGE_CODE].empty()) {
+        throw std::invalid_argument("bad exchange code");
+    }
+    target.market.xcode = values[Field::EXCHANGE_CODE][0];
+}
+
+template <typename Values>
+bool Move::assign(const Values & values) {
+    if (!check(values)) {
+        return false;
+    }
+    // MarketMaker,EventSymbol,EventTime,ExchangeCode,MarketMaker,BidTime,BidPrice,BidSize,BidCount,AskTime,AskPrice,AskSize,AskCount
+    event.symbol = values[Field::EVENT_SYMBOL];
+    assign_sides(values, *this);
     market.market_maker = values[Field::MARKET_MAKER];
     market.flags = values.size() == Field::COUNT ? values[Field::FLAGS] : "";
     
     return true;
 }
 
+bool Move::from(const std::vector<std::string> & values) {
+    return assign(values);
+}
+
+bool Move::from(const std::vector<std::string_view> & values) {
+    return assign(values);
+}
+
+template <typename Values>
+bool InternedMove::assign(const Values & values) {
+    using Field = equity::Move::Field;
+    
+    if (!equity::Move::check(values)) {
+        return false;
+    }
+    
+    auto & strings = util::SymbolTable::global();
+    event.symbol = strings.intern(values[Field::EVENT_SYMBOL]);
+    equity::Move::assign_sides(values, *this);
+    market.market_maker = strings.intern(values[Field::MARKET_MAKER]);
+    market.flags = strings.intern(values.size() == Field::COUNT ? std::string_view(values[Field::FLAGS]) : std::string_view());
+    
+    return true;
+}
+
+bool InternedMove::from(const std::vector<std::string> & values) {
+    return assign(values);
+}
+
+bool InternedMove::from(const std::vector<std::string_view> & values) {
+    return assign(values);
+}
+
 std::ostream & operator << (std::ostream & out, Move & move) {
     return out << "EqMove(" << move.event.symbol << ", "
         << "bid(price=" << move.bid.price << ", count=" << move.bid.count << ", size=" << move.bid.size << ", time=" << std::chrono::duration_cast<std::chrono::milliseconds>(move.bid.time.time_since_epoch()).count() << "), "
         << "ask(price=" << move.ask.price << ", count=" << move.ask.count << ", size=" << move.ask.size << ", time=" << std::chrono::duration_cast<std::chrono::milliseconds>(move.ask.time.time_since_epoch()).count() << ")";
 }
 
+std::ostream & operator << (std::ostream & out, const InternedMove & move) {
+    return out << "EqMove(" << move.symbol() << ", "
+        << "bid(price=" << move.bid.price << ", count=" << move.bid.count << ", size=" << move.bid.size << ", time=" << std::chrono::duration_cast<std::chrono::milliseconds>(move.bid.time.time_since_epoch()).count() << "), "
+        << "ask(price=" << move.ask.price << ", count=" << move.ask.count << ", size=" << move.ask.size << ", time=" << std::chrono::duration_cast<std::chrono::milliseconds>(move.ask.time.time_since_epoch()).count() << ")";
+}
+
 }
 }
@@ -11,12 +11,19 @@
 #include <iomanip>
 #include <ctime>
 #include <iostream>
+#include <string_view>
+#include <vector>
 
 #include "../util/Move.hpp"
+#include "../util/FixedPrice.hpp"
+#include "../util/SymbolTable.hpp"
 #include "../csv/Schemas.hpp"
 
 namespace mkt {
 namespace equity {
+
+    class Move;
+    class InternedMove;
     
     template <typename ExchangeCode, typename MarketMakerId = int, typename Flags = std::string>
     struct MoveMetadata {
@@ -25,7 +32,10 @@ namespace equity {
         Flags flags;
     };
     
-    class Move: public mkt::util::Move<std::chrono::time_point<std::chrono::system_clock>, long double, unsigned, unsigned, MoveMetadata<char, std::string>> {
+    // quotes come with at most 4 decimals
+    using Price = mkt::util::FixedPrice<4>;
+
+    class Move: public mkt::util::Move<std::chrono::time_point<std::chrono::system_clock>, Price, unsigned, unsigned, MoveMetadata<char, std::string>> {
         
         using clock = std::chrono::system_clock;
         
@@ -47,12 +57,44 @@ namespace equity {
             COUNT
         };
         
-        static int ord(char c, int pw = 1) { return pw * (c - '0'); }
-        static std::chrono::time_point<clock> parse_date(const std::string & value);
+        static std::chrono::time_point<clock> parse_date(std::string_view value);
+        static unsigned parse_count(std::string_view value);
+        
+        // whether values has every field, flags being optional
+        template <typename Values>
+        static bool check(const Values & values);
+        // the times, prices, sizes and counts, the same for any Move
+        template <typename Values, typename Target>
+        static void assign_sides(const Values & values, Target & target);
+        
+        template <typename Values>
+        bool assign(const Values & values);
+        
+        friend InternedMove;
     public:
         bool from(const std::vector<std::string> & values);
+        // the values csv::MappedReader gives, no copies until the strings are stored
+        bool from(const std::vector<std::string_view> & values);
         friend std::ostream & operator << (std::ostream & out, Move & move);
     };
+
+    // A Move with its symbol, market maker and flags interned in
+    // util::SymbolTable::global(): parsing a quote allocates nothing once
+    // its strings have been seen, and comparing or hashing them is
+    // comparing or hashing an integer.
+    class InternedMove: public mkt::util::Move<std::chrono::time_point<std::chrono::system_clock>, Price, unsigned, unsigned, MoveMetadata<char, util::SymbolId, util::SymbolId>, util::SymbolId> {
+        template <typename Values>
+        bool assign(const Values & values);
+    public:
+        bool from(const std::vector<std::string> & values);
+        bool from(const std::vector<std::string_view> & values);
+        
+        std::string_view symbol() const { return util::SymbolTable::global().view(event.symbol); }
+        std::string_view market_maker() const { return util::SymbolTable::global().view(market.market_maker); }
+        std::string_view flags() const { return util::SymbolTable::global().view(market.flags); }
+        
+        friend std::ostream & operator << (std::ostream & out, const InternedMove & move);
+    };
 }
 
 }
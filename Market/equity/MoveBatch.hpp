@@ -0,0 +1,349 @@
+//
+//  MoveBatch.hpp
+//  Market
+//
+//  Created by Blagovest on 23/12/20.
+//
+
+#ifndef Equity_MoveBatch_hpp
+#define Equity_MoveBatch_hpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "Move.hpp"
+#include "TickStore.hpp"
+#include "TickCodec.hpp"
+#include "../csv/MappedReader.hpp"
+#include "../util/AlignedAllocator.hpp"
+#include "../util/CandleStick.hpp"
+#include "../util/SymbolTable.hpp"
+
+namespace mkt {
+namespace equity {
+
+    class MoveBatch;
+
+namespace move_batch {
+
+    // every column starts on a cache line of its own
+    template <typename T>
+    using Column = std::vector<T, util::AlignedAllocator<T, 64>>;
+
+    // a candle per interval with quotes in it, and when the interval starts
+    using Candles = std::vector<std::pair<std::chrono::system_clock::time_point, util::CandleStick<Price>>>;
+
+}
+
+    // Moves held column by column, the same columns as a TickStore: times
+    // in nanoseconds since the epoch, prices in Price ticks and symbols,
+    // market makers and flags as ids in util::SymbolTable::global(), the
+    // same as an InternedMove's. A computation over a few fields then
+    // streams through just those arrays, instead of striding over whole
+    // Moves.
+    class MoveBatch {
+        static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+        
+        // Appends the interned ids of another container's string ids,
+        // source(id) being the string; remap caches what each became.
+        template <typename Source>
+        void append_ids(move_batch::Column<uint32_t> & to, const uint32_t * from, size_t n, std::vector<uint32_t> & remap, Source && source) {
+            to.reserve(to.size() + n);
+            for (size_t i = 0; i < n; ++i) {
+                auto id = from[i];
+                if (id >= remap.size()) {
+                    remap.resize(id + 1, none);
+                }
+                if (remap[id] == none) {
+                    remap[id] = intern(source(id));
+                }
+                to.push_back(remap[id]);
+            }
+        }
+    public:
+        template <typename T>
+        using Column = move_batch::Column<T>;
+        
+        Column<int64_t> event_times, bid_times, ask_times;
+        Column<int64_t> bid_prices, ask_prices;
+        Column<uint32_t> bid_sizes, ask_sizes, bid_counts, ask_counts;
+        Column<uint32_t> symbols, market_makers, flags;
+        Column<char> exchange_codes;
+        
+        static util::SymbolId intern(std::string_view value) { return util::SymbolTable::global().intern(value); }
+        static std::string_view string(util::SymbolId id) { return util::SymbolTable::global().view(id); }
+        size_t size() const noexcept { return event_times.size(); }
+        bool empty() const noexcept { return event_times.empty(); }
+        
+        void reserve(size_t rows) {
+            for (auto column : { &event_times, &bid_times, &ask_times, &bid_prices, &ask_prices }) {
+                column->reserve(rows);
+            }
+            for (auto column : { &bid_sizes, &ask_sizes, &bid_counts, &ask_counts, &symbols, &market_makers, &flags }) {
+                column->reserve(rows);
+            }
+            exchange_codes.reserve(rows);
+        }
+        
+        // drops the rows, keeps the capacity
+        void clear() noexcept {
+            for (auto column : { &event_times, &bid_times, &ask_times, &bid_prices, &ask_prices }) {
+                column->clear();
+            }
+            for (auto column : { &bid_sizes, &ask_sizes, &bid_counts, &ask_counts, &symbols, &market_makers, &flags }) {
+                column->clear();
+            }
+            exchange_codes.clear();
+        }
+        
+        void append(const Move & move) {
+            event_times.push_back(tick_store::nanos(move.event.time));
+            bid_times.push_back(tick_store::nanos(move.bid.time));
+            ask_times.push_back(tick_store::nanos(move.ask.time));
+            bid_prices.push_back(move.bid.price.ticks());
+            ask_prices.push_back(move.ask.price.ticks());
+            bid_sizes.push_back(move.bid.size);
+            ask_sizes.push_back(move.ask.size);
+            bid_counts.push_back(move.bid.count);
+            ask_counts.push_back(move.ask.count);
+            symbols.push_back(intern(move.event.symbol));
+            market_makers.push_back(intern(move.market.market_maker));
+            flags.push_back(intern(move.market.flags));
+            exchange_codes.push_back(move.market.xcode);
+        }
+        
+        // no strings to look up, the ids are the same
+        void append(const InternedMove & move) {
+            event_times.push_back(tick_store::nanos(move.event.time));
+            bid_times.push_back(tick_store::nanos(move.bid.time));
+            ask_times.push_back(tick_store::nanos(move.ask.time));
+            bid_prices.push_back(move.bid.price.ticks());
+            ask_prices.push_back(move.ask.price.ticks());
+            bid_sizes.push_back(move.bid.size);
+            ask_sizes.push_back(move.ask.size);
+            bid_counts.push_back(move.bid.count);
+            ask_counts.push_back(move.ask.count);
+            symbols.push_back(move.event.symbol);
+            market_makers.push_back(move.market.market_maker);
+            flags.push_back(move.market.flags);
+            exchange_codes.push_back(move.market.xcode);
+        }
+        
+        // Appends every line left in reader that parses, through one
+        // InternedMove reused for all of them; returns how many were appended.
+        template <char delim>
+        size_t append(csv::MappedReader<delim> & reader) {
+            typename csv::MappedReader<delim>::Values values;
+            InternedMove move;
+            size_t appended = 0;
+            
+            while (reader.read_next_line(values)) {
+                bool ok = false;
+                try {
+                    ok = move.from(values);
+                } catch (const std::logic_error &) {}
+                
+                if (ok) {
+                    append(move);
+                    ++appended;
+                }
+            }
+            return appended;
+        }
+        
+        // Appends the store's rows [first, last), the numeric columns copied
+        // as they lie in the file.
+        void append(const TickStore & store, size_t first, size_t last) {
+            last = std::min(last, store.size());
+            if (first >= last) {
+                return;
+            }
+            
+            auto copy = [first, last] (auto & to, const auto * from) {
+                to.insert(to.end(), from + first, from + last);
+            };
+            copy(event_times, store.event_times());
+            copy(bid_times, store.bid_times());
+            copy(ask_times, store.ask_times());
+            copy(bid_prices, store.bid_prices());
+            copy(ask_prices, store.ask_prices());
+            copy(bid_sizes, store.bid_sizes());
+            copy(ask_sizes, store.ask_sizes());
+            copy(bid_counts, store.bid_counts());
+            copy(ask_counts, store.ask_counts());
+            copy(exchange_codes, store.exchange_codes());
+            
+            std::vector<uint32_t> remap;
+            auto lookup = [&store] (uint32_t id) { return store.string(id); };
+            append_ids(symbols, store.symbols() + first, last - first, remap, lookup);
+            append_ids(market_makers, store.market_makers() + first, last - first, remap, lookup);
+            append_ids(flags, store.flags() + first, last - first, remap, lookup);
+        }
+        
+        void append(const TickStore & store) { append(store, 0, store.size()); }
+        
+        // Appends columns decoder decoded, their ids being the decoder's.
+        void append(const TickDecoder & decoder, const tick_codec::Columns & columns) {
+            auto copy = [] (auto & to, const auto & from) {
+                to.insert(to.end(), from.begin(), from.end());
+            };
+            copy(event_times, columns.event_times);
+            copy(bid_times, columns.bid_times);
+            copy(ask_times, columns.ask_times);
+            copy(bid_prices, columns.bid_prices);
+            copy(ask_prices, columns.ask_prices);
+            copy(bid_sizes, columns.bid_sizes);
+            copy(ask_sizes, columns.ask_sizes);
+            copy(bid_counts, columns.bid_counts);
+            copy(ask_counts, columns.ask_counts);
+            for (auto code : columns.exchange_codes) {
+                exchange_codes.push_back(static_cast<char>(code));
+            }
+            
+            std::vector<uint32_t> remap;
+            auto lookup = [&decoder] (uint32_t id) { return decoder.string(id); };
+            append_ids(symbols, columns.symbols.data(), columns.size(), remap, lookup);
+            append_ids(market_makers, columns.market_makers.data(), columns.size(), remap, lookup);
+            append_ids(flags, columns.flags.data(), columns.size(), remap, lookup);
+        }
+        
+        // Appends every block of decoder; false if one doesn't decode, with
+        // the blocks before it appended.
+        bool append(const TickDecoder & decoder) {
+            tick_codec::Columns columns;
+            for (size_t i = 0; i < decoder.blocks(); ++i) {
+                columns.clear();
+                if (!decoder.decode(i, columns)) {
+                    return false;
+                }
+                append(decoder, columns);
+            }
+            return true;
+        }
+        
+        // row i put back together
+        Move move(size_t i) const {
+            Move move;
+            move.event.time = tick_store::time(event_times[i]);
+            move.event.symbol = string(symbols[i]);
+            move.bid.time = tick_store::time(bid_times[i]);
+            move.bid.price = Price::from_ticks(bid_prices[i]);
+            move.bid.size = bid_sizes[i];
+            move.bid.count = bid_counts[i];
+            move.ask.time = tick_store::time(ask_times[i]);
+            move.ask.price = Price::from_ticks(ask_prices[i]);
+            move.ask.size = ask_sizes[i];
+            move.ask.count = ask_counts[i];
+            move.market.xcode = exchange_codes[i];
+            move.market.market_maker = string(market_makers[i]);
+            move.market.flags = string(flags[i]);
+            return move;
+        }
+    };
+
+namespace move_batch {
+
+    // Analytics over the columns, written as plain loops over arrays with
+    // no branches in the body so the compiler can vectorize them.
+
+    // ask - bid of every row, in Price ticks
+    inline Column<int64_t> spreads(const MoveBatch & batch) {
+        auto n = batch.size();
+        Column<int64_t> out (n);
+        
+        auto bid = batch.bid_prices.data();
+        auto ask = batch.ask_prices.data();
+        auto spread = out.data();
+        for (size_t i = 0; i < n; ++i) {
+            spread[i] = ask[i] - bid[i];
+        }
+        return out;
+    }
+
+    inline Price mean_spread(const MoveBatch & batch) {
+        auto n = batch.size();
+        if (!n) {
+            return Price();
+        }
+        
+        auto bid = batch.bid_prices.data();
+        auto ask = batch.ask_prices.data();
+        int64_t sum = 0;
+        for (size_t i = 0; i < n; ++i) {
+            sum += ask[i] - bid[i];
+        }
+        return Price::from_ticks(sum).scale(1, static_cast<int64_t>(n));
+    }
+
+    // Size weighted average of n prices, zero if there's no size at all;
+    // the sum of price * size must fit an int64 of ticks.
+    inline Price vwap(const int64_t * prices, const uint32_t * sizes, size_t n) {
+        int64_t value = 0, volume = 0;
+        for (size_t i = 0; i < n; ++i) {
+            value += prices[i] * sizes[i];
+            volume += sizes[i];
+        }
+        return volume ? Price::from_ticks(value).scale(1, volume) : Price();
+    }
+
+    inline Price bid_vwap(const MoveBatch & batch) {
+        return vwap(batch.bid_prices.data(), batch.bid_sizes.data(), batch.size());
+    }
+
+    inline Price ask_vwap(const MoveBatch & batch) {
+        return vwap(batch.ask_prices.data(), batch.ask_sizes.data(), batch.size());
+    }
+
+    // Candles of n prices over intervals of the given length, by the times
+    // next to them. Every run of consecutive rows in the same interval is
+    // one candle, so times in order give one per interval; the low and high
+    // of a run are found in one pass over its prices.
+    inline Candles candles(const int64_t * times, const int64_t * prices, size_t n, std::chrono::nanoseconds interval) {
+        auto length = std::max<int64_t>(interval.count(), 1);
+        auto start = [length] (int64_t time) {
+            auto remainder = time % length;
+            return time - (remainder < 0 ? remainder + length : remainder);
+        };
+        
+        Candles out;
+        for (size_t first = 0, last; first < n; first = last) {
+            auto begin = start(times[first]);
+            for (last = first + 1; last < n && times[last] - begin >= 0 && times[last] - begin < length; ++last);
+            
+            int64_t low = prices[first], high = prices[first];
+            for (auto i = first + 1; i < last; ++i) {
+                low = std::min(low, prices[i]);
+                high = std::max(high, prices[i]);
+            }
+            
+            // update keeps the first price as the open, the last as the close
+            util::CandleStick<Price> candle;
+            for (auto price : { prices[first], low, high, prices[last - 1] }) {
+                candle.update(Price::from_ticks(price));
+            }
+            out.emplace_back(tick_store::time(begin), candle);
+        }
+        return out;
+    }
+
+    inline Candles bid_candles(const MoveBatch & batch, std::chrono::nanoseconds interval) {
+        return candles(batch.bid_times.data(), batch.bid_prices.data(), batch.size(), interval);
+    }
+
+    inline Candles ask_candles(const MoveBatch & batch, std::chrono::nanoseconds interval) {
+        return candles(batch.ask_times.data(), batch.ask_prices.data(), batch.size(), interval);
+    }
+
+}
+
+}
+}
+
+#endif /* MoveBatch_hpp */
@@ -0,0 +1,459 @@
+//
+//  TickCodec.hpp
+//  Market
+//
+//  Created by Blagovest on 22/12/20.
+//
+
+#ifndef Equity_TickCodec_hpp
+#define Equity_TickCodec_hpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Move.hpp"
+#include "TickStore.hpp"
+
+namespace mkt {
+namespace equity {
+
+    class TickEncoder;
+    class TickDecoder;
+
+namespace tick_codec {
+
+    // Small signed numbers to small unsigned ones: 0, -1, 1, -2, ...
+    constexpr uint64_t zigzag(int64_t value) noexcept {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    constexpr int64_t unzigzag(uint64_t value) noexcept {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    // two's complement wrapping, as bad data or far apart values may overflow
+    constexpr int64_t add(int64_t a, int64_t b) noexcept {
+        return static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+    }
+
+    constexpr int64_t sub(int64_t a, int64_t b) noexcept {
+        return static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+    }
+
+    // LEB128, 7 bits a byte, low bits first
+    inline void put(std::string & out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    // Reads one varint at in, which has to be before the end of a buffer
+    // whose last byte ends a varint, so it never reads past it.
+    inline uint64_t get(const uint8_t * & in) noexcept {
+        uint64_t value = *in++;
+        if (value < 0x80) {
+            return value;
+        }
+        value &= 0x7f;
+        for (unsigned shift = 7; shift < 64; shift += 7) {
+            uint64_t byte = *in++;
+            value |= (byte & 0x7f) << shift;
+            if (byte < 0x80) {
+                break;
+            }
+        }
+        return value;
+    }
+
+    // Decoded rows, a vector per field; strings are ids, see TickDecoder::string.
+    struct Columns {
+        std::vector<int64_t> event_times, bid_times, ask_times;     // nanoseconds since the epoch
+        std::vector<int64_t> bid_prices, ask_prices;                // Price ticks
+        std::vector<uint32_t> bid_sizes, ask_sizes, bid_counts, ask_counts;
+        std::vector<uint32_t> symbols, market_makers, flags;
+        std::vector<uint32_t> exchange_codes;
+        
+        size_t size() const { return event_times.size(); }
+        
+        void clear() {
+            for (auto column : { &event_times, &bid_times, &ask_times, &bid_prices, &ask_prices }) {
+                column->clear();
+            }
+            for (auto column : { &bid_sizes, &ask_sizes, &bid_counts, &ask_counts, &symbols, &market_makers, &flags, &exchange_codes }) {
+                column->clear();
+            }
+        }
+    };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t block_rows;
+        uint64_t rows;
+        uint64_t blocks;
+        uint64_t strings;
+        uint64_t strings_offset;
+        uint64_t index_offset;
+    };
+
+    // where a block's bytes are and what times it covers
+    struct Block {
+        int64_t min_time;
+        int64_t max_time;
+        uint64_t offset;
+        uint64_t size;
+        uint32_t rows;
+        uint32_t padding;
+    };
+
+    constexpr char magic[8] = { 'M', 'K', 'T', 'T', 'I', 'C', 'K', 'Z' };
+    constexpr uint32_t version = 1;
+
+    // first value as is, then the change in the change
+    inline void put_delta_of_delta(std::string & out, const std::vector<int64_t> & values) {
+        int64_t previous = 0, delta = 0;
+        for (auto value : values) {
+            put(out, zigzag(sub(sub(value, previous), delta)));
+            delta = sub(value, previous);
+            previous = value;
+        }
+    }
+
+    inline void put_delta(std::string & out, const std::vector<int64_t> & values, const std::vector<int64_t> & base) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            put(out, zigzag(sub(values[i], base[i])));
+        }
+    }
+
+    // first value as is, then the change from the one before
+    inline void put_delta(std::string & out, const std::vector<int64_t> & values) {
+        int64_t previous = 0;
+        for (auto value : values) {
+            put(out, zigzag(sub(value, previous)));
+            previous = value;
+        }
+    }
+
+    // (value, run length) pairs
+    inline void put_runs(std::string & out, const std::vector<uint32_t> & values) {
+        for (size_t i = 0; i < values.size(); ) {
+            auto run = i + 1;
+            while (run < values.size() && values[run] == values[i]) {
+                ++run;
+            }
+            put(out, values[i]);
+            put(out, run - i);
+            i = run;
+        }
+    }
+
+    // The get_ functions read rows values from in, stopping at end; false
+    // if they'd have to go past it.
+    inline bool get_delta_of_delta(const uint8_t * & in, const uint8_t * end, int64_t * out, size_t rows) noexcept {
+        int64_t previous = 0, delta = 0;
+        for (size_t i = 0; i < rows; ++i) {
+            if (in == end) {
+                return false;
+            }
+            delta = add(delta, unzigzag(get(in)));
+            previous = add(previous, delta);
+            out[i] = previous;
+        }
+        return true;
+    }
+
+    inline bool get_delta(const uint8_t * & in, const uint8_t * end, int64_t * out, const int64_t * base, size_t rows) noexcept {
+        for (size_t i = 0; i < rows; ++i) {
+            if (in == end) {
+                return false;
+            }
+            out[i] = add(base[i], unzigzag(get(in)));
+        }
+        return true;
+    }
+
+    inline bool get_delta(const uint8_t * & in, const uint8_t * end, int64_t * out, size_t rows) noexcept {
+        int64_t previous = 0;
+        for (size_t i = 0; i < rows; ++i) {
+            if (in == end) {
+                return false;
+            }
+            previous = add(previous, unzigzag(get(in)));
+            out[i] = previous;
+        }
+        return true;
+    }
+
+    // also false on runs longer than what's left of the rows
+    inline bool get_runs(const uint8_t * & in, const uint8_t * end, uint32_t * out, size_t rows) noexcept {
+        for (size_t i = 0; i < rows; ) {
+            if (in == end) {
+                return false;
+            }
+            auto value = static_cast<uint32_t>(get(in));
+            if (in == end) {
+                return false;
+            }
+            auto run = get(in);
+            if (!run || run > rows - i) {
+                return false;
+            }
+            std::fill_n(out + i, run, value);
+            i += run;
+        }
+        return true;
+    }
+
+}
+
+    // Compresses Moves a block of rows at a time, each block a column after
+    // the other: event times as delta of deltas, bid and ask times as the
+    // difference from the event time, prices as deltas in ticks, all as
+    // zigzag varints; sizes, counts, exchange codes and strings (as ids)
+    // run-length encoded. Blocks start afresh so any one decodes alone.
+    class TickEncoder {
+        uint32_t block_rows;
+        uint64_t rows;
+        tick_codec::Columns pending;
+        std::string data;
+        std::vector<tick_codec::Block> index;
+        std::unordered_map<std::string, uint32_t> dictionary;
+        std::vector<const std::string *> strings;
+        
+        uint32_t intern(const std::string & value) {
+            auto [it, inserted] = dictionary.try_emplace(value, static_cast<uint32_t>(strings.size()));
+            if (inserted) {
+                strings.push_back(&it->first);
+            }
+            return it->second;
+        }
+        
+        void flush() {
+            using namespace tick_codec;
+            
+            if (!pending.size()) {
+                return;
+            }
+            
+            auto [min, max] = std::minmax_element(pending.event_times.begin(), pending.event_times.end());
+            auto offset = data.size();
+            
+            put_delta_of_delta(data, pending.event_times);
+            put_delta(data, pending.bid_times, pending.event_times);
+            put_delta(data, pending.ask_times, pending.event_times);
+            put_delta(data, pending.bid_prices);
+            put_delta(data, pending.ask_prices);
+            for (auto column : { &pending.bid_sizes, &pending.ask_sizes, &pending.bid_counts, &pending.ask_counts, &pending.symbols, &pending.market_makers, &pending.flags, &pending.exchange_codes }) {
+                put_runs(data, *column);
+            }
+            
+            index.push_back(Block { *min, *max, offset, data.size() - offset, static_cast<uint32_t>(pending.size()), 0 });
+            pending.clear();
+        }
+    public:
+        explicit TickEncoder(uint32_t block_rows = 4096): block_rows(std::max(1u, block_rows)), rows() {}
+        
+        void append(const Move & move) {
+            pending.event_times.push_back(tick_store::nanos(move.event.time));
+            pending.bid_times.push_back(tick_store::nanos(move.bid.time));
+            pending.ask_times.push_back(tick_store::nanos(move.ask.time));
+            pending.bid_prices.push_back(move.bid.price.ticks());
+            pending.ask_prices.push_back(move.ask.price.ticks());
+            pending.bid_sizes.push_back(move.bid.size);
+            pending.ask_sizes.push_back(move.ask.size);
+            pending.bid_counts.push_back(move.bid.count);
+            pending.ask_counts.push_back(move.ask.count);
+            pending.symbols.push_back(intern(move.event.symbol));
+            pending.market_makers.push_back(intern(move.market.market_maker));
+            pending.flags.push_back(intern(move.market.flags));
+            pending.exchange_codes.push_back(static_cast<unsigned char>(move.market.xcode));
+            
+            if (pending.size() == block_rows) {
+                flush();
+            }
+            ++rows;
+        }
+        
+        size_t size() const { return rows; }
+        
+        // Header | blocks | strings | block index, in one buffer to write
+        // out or hand to TickDecoder. The encoder is done after that.
+        std::string finish() {
+            using namespace tick_codec;
+            
+            flush();
+            
+            Header header {};
+            std::memcpy(header.magic, tick_codec::magic, sizeof(header.magic));
+            header.version = tick_codec::version;
+            header.block_rows = block_rows;
+            header.rows = rows;
+            header.blocks = index.size();
+            header.strings = strings.size();
+            
+            std::string out (reinterpret_cast<const char *>(&header), sizeof(header));
+            for (auto & block : index) {
+                block.offset += sizeof(header);
+            }
+            out += data;
+            
+            header.strings_offset = out.size();
+            for (auto string : strings) {
+                put(out, string->size());
+                out += *string;
+            }
+            
+            header.index_offset = out.size();
+            out.append(reinterpret_cast<const char *>(index.data()), index.size() * sizeof(Block));
+            std::memcpy(out.data(), &header, sizeof(header));
+            
+            std::string().swap(data);
+            return out;
+        }
+        
+        // finish() into a file, false if it can't be written (see errno)
+        bool save(const char * path) {
+            auto bytes = finish();
+            std::FILE * file = std::fopen(path, "wb");
+            if (!file) {
+                return false;
+            }
+            bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+            return std::fclose(file) == 0 && ok;
+        }
+    };
+
+    // Reads what TickEncoder wrote, e.g. from a util::MappedFile's view(),
+    // which has to outlive it. False if the bytes aren't a valid encoding.
+    class TickDecoder {
+        std::string_view bytes;
+        tick_codec::Header header;
+        std::vector<tick_codec::Block> index;
+        std::vector<std::string_view> strings;
+        bool valid;
+        
+        bool load() {
+            using namespace tick_codec;
+            
+            if (bytes.size() < sizeof(header)) {
+                return false;
+            }
+            std::memcpy(&header, bytes.data(), sizeof(header));
+            
+            if (std::memcmp(header.magic, tick_codec::magic, sizeof(header.magic)) || header.version != tick_codec::version
+                || header.strings_offset > header.index_offset || header.index_offset > bytes.size()
+                || header.blocks != (bytes.size() - header.index_offset) / sizeof(Block)) {
+                return false;
+            }
+            
+            index.resize(header.blocks);
+            std::memcpy(index.data(), bytes.data() + header.index_offset, index.size() * sizeof(Block));
+            for (auto & block : index) {
+                if (block.offset < sizeof(header) || block.offset > header.strings_offset || block.size > header.strings_offset - block.offset) {
+                    return false;
+                }
+            }
+            
+            auto in = reinterpret_cast<const uint8_t *>(bytes.data() + header.strings_offset);
+            auto end = reinterpret_cast<const uint8_t *>(bytes.data() + header.index_offset);
+            for (uint64_t i = 0; i < header.strings; ++i) {
+                // a byte at a time, nothing says the section ends a varint
+                uint64_t length = 0;
+                for (unsigned shift = 0; ; shift += 7) {
+                    if (in == end || shift > 63) {
+                        return false;
+                    }
+                    auto byte = *in++;
+                    length |= uint64_t(byte & 0x7f) << shift;
+                    if (byte < 0x80) {
+                        break;
+                    }
+                }
+                if (length > static_cast<uint64_t>(end - in)) {
+                    return false;
+                }
+                strings.emplace_back(reinterpret_cast<const char *>(in), length);
+                in += length;
+            }
+            
+            return true;
+        }
+    public:
+        explicit TickDecoder(std::string_view bytes): bytes(bytes), header(), valid(false) {
+            valid = load();
+        }
+        
+        explicit operator bool() const { return valid; }
+        size_t size() const { return valid ? header.rows : 0; }
+        size_t blocks() const { return index.size(); }
+        const tick_codec::Block & block(size_t i) const { return index[i]; }
+        std::string_view string(uint32_t id) const { return strings[id]; }
+        
+        // the first block that may hold a row at or after time, blocks() if none
+        size_t find(std::chrono::system_clock::time_point time) const {
+            auto nanos = tick_store::nanos(time);
+            for (size_t i = 0; i < index.size(); ++i) {
+                if (index[i].max_time >= nanos) {
+                    return i;
+                }
+            }
+            return index.size();
+        }
+        
+        // Appends block i's rows to out; false if it doesn't decode, in
+        // which case out is left as it was.
+        bool decode(size_t i, tick_codec::Columns & out) const {
+            using namespace tick_codec;
+            
+            auto & block = index[i];
+            auto in = reinterpret_cast<const uint8_t *>(bytes.data() + block.offset);
+            auto end = in + block.size;
+            auto rows = block.rows;
+            auto at = out.size();
+            
+            for (auto column : { &out.event_times, &out.bid_times, &out.ask_times, &out.bid_prices, &out.ask_prices }) {
+                column->resize(at + rows);
+            }
+            for (auto column : { &out.bid_sizes, &out.ask_sizes, &out.bid_counts, &out.ask_counts, &out.symbols, &out.market_makers, &out.flags, &out.exchange_codes }) {
+                column->resize(at + rows);
+            }
+            
+            // with the last byte ending a varint no read goes past the block
+            bool ok = !rows || (block.size && end[-1] < 0x80);
+            ok = ok && get_delta_of_delta(in, end, out.event_times.data() + at, rows);
+            ok = ok && get_delta(in, end, out.bid_times.data() + at, out.event_times.data() + at, rows);
+            ok = ok && get_delta(in, end, out.ask_times.data() + at, out.event_times.data() + at, rows);
+            ok = ok && get_delta(in, end, out.bid_prices.data() + at, rows);
+            ok = ok && get_delta(in, end, out.ask_prices.data() + at, rows);
+            for (auto column : { &out.bid_sizes, &out.ask_sizes, &out.bid_counts, &out.ask_counts, &out.symbols, &out.market_makers, &out.flags, &out.exchange_codes }) {
+                ok = ok && get_runs(in, end, column->data() + at, rows);
+            }
+            for (auto id : { &out.symbols, &out.market_makers, &out.flags }) {
+                ok = ok && std::all_of(id->begin() + at, id->end(), [this] (uint32_t id) { return id < strings.size(); });
+            }
+            
+            if (!ok) {
+                for (auto column : { &out.event_times, &out.bid_times, &out.ask_times, &out.bid_prices, &out.ask_prices }) {
+                    column->resize(at);
+                }
+                for (auto column : { &out.bid_sizes, &out.ask_sizes, &out.bid_counts, &out.ask_counts, &out.symbols, &out.market_makers, &out.flags, &out.exchange_codes }) {
+                    column->resize(at);
+                }
+            }
+            return ok;
+        }
+    };
+
+}
+}
+
+#endif /* TickCodec_hpp */
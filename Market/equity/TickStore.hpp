@@ -0,0 +1,359 @@
+//
+//  TickStore.hpp
+//  Market
+//
+//  Created by Blagovest on 21/12/20.
+//
+
+#ifndef Equity_TickStore_hpp
+#define Equity_TickStore_hpp
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Move.hpp"
+#include "../csv/MappedReader.hpp"
+#include "../util/MappedFile.hpp"
+
+namespace mkt {
+namespace equity {
+
+    class TickStoreWriter;
+    class TickStore;
+
+namespace tick_store {
+
+    // The on-disk layout, in the writing machine's byte order:
+    //
+    //     Header | column 0 | column 1 | ... | strings | block index
+    //
+    // Every column is one array of rows values starting at a 64 byte
+    // boundary. Symbols, market makers and flags are ids into the strings
+    // section, a uint32 length followed by the bytes for each. The block
+    // index holds the min and max event time of every block_rows rows.
+    enum Column: uint32_t {
+        EVENT_TIME, BID_TIME, ASK_TIME,     // int64 nanoseconds since the epoch
+        BID_PRICE, ASK_PRICE,               // int64 Price ticks
+        BID_SIZE, ASK_SIZE,                 // uint32
+        BID_COUNT, ASK_COUNT,               // uint32
+        SYMBOL, MARKET_MAKER, FLAGS,        // uint32 string ids
+        EXCHANGE_CODE,                      // char
+        COUNT
+    };
+
+    constexpr size_t width[Column::COUNT] = { 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 1 };
+
+    constexpr char magic[8] = { 'M', 'K', 'T', 'T', 'I', 'C', 'K', 'S' };
+    constexpr uint32_t version = 1;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t block_rows;
+        uint64_t rows;
+        uint64_t strings;                   // how many
+        uint64_t columns[Column::COUNT];    // offsets
+        uint64_t strings_offset;
+        uint64_t index_offset;
+    };
+
+    struct Block {
+        int64_t min_time;
+        int64_t max_time;
+    };
+
+    constexpr uint64_t align(uint64_t offset) {
+        return (offset + 63) / 64 * 64;
+    }
+
+    inline int64_t nanos(std::chrono::system_clock::time_point time) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+
+    inline std::chrono::system_clock::time_point time(int64_t nanos) {
+        return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanos)));
+    }
+
+}
+
+    // Collects Moves column by column, then writes them out in one go.
+    class TickStoreWriter {
+        using Column = tick_store::Column;
+        
+        uint32_t block_rows;
+        std::vector<int64_t> times[3];
+        std::vector<int64_t> prices[2];
+        std::vector<uint32_t> quantities[4];
+        std::vector<uint32_t> ids[3];
+        std::vector<char> xcodes;
+        std::unordered_map<std::string, uint32_t> dictionary;
+        std::vector<const std::string *> strings;
+        
+        uint32_t intern(const std::string & value) {
+            auto [it, inserted] = dictionary.try_emplace(value, static_cast<uint32_t>(strings.size()));
+            if (inserted) {
+                strings.push_back(&it->first);
+            }
+            return it->second;
+        }
+        
+        const void * column(Column column) const {
+            switch (column) {
+                case Column::EVENT_TIME: case Column::BID_TIME: case Column::ASK_TIME: return times[column - Column::EVENT_TIME].data();
+                case Column::BID_PRICE: case Column::ASK_PRICE: return prices[column - Column::BID_PRICE].data();
+                case Column::BID_SIZE: case Column::ASK_SIZE: case Column::BID_COUNT: case Column::ASK_COUNT: return quantities[column - Column::BID_SIZE].data();
+                case Column::SYMBOL: case Column::MARKET_MAKER: case Column::FLAGS: return ids[column - Column::SYMBOL].data();
+                default: return xcodes.data();
+            }
+        }
+    public:
+        explicit TickStoreWriter(uint32_t block_rows = 4096): block_rows(std::max(1u, block_rows)) {}
+        
+        void append(const Move & move) {
+            times[0].push_back(tick_store::nanos(move.event.time));
+            times[1].push_back(tick_store::nanos(move.bid.time));
+            times[2].push_back(tick_store::nanos(move.ask.time));
+            prices[0].push_back(move.bid.price.ticks());
+            prices[1].push_back(move.ask.price.ticks());
+            quantities[0].push_back(move.bid.size);
+            quantities[1].push_back(move.ask.size);
+            quantities[2].push_back(move.bid.count);
+            quantities[3].push_back(move.ask.count);
+            ids[0].push_back(intern(move.event.symbol));
+            ids[1].push_back(intern(move.market.market_maker));
+            ids[2].push_back(intern(move.market.flags));
+            xcodes.push_back(move.market.xcode);
+        }
+        
+        size_t size() const { return xcodes.size(); }
+        
+        // false if the file can't be written, see errno
+        bool save(const char * path) const {
+            using tick_store::align;
+            
+            tick_store::Header header {};
+            std::memcpy(header.magic, tick_store::magic, sizeof(header.magic));
+            header.version = tick_store::version;
+            header.block_rows = block_rows;
+            header.rows = size();
+            header.strings = strings.size();
+            
+            uint64_t offset = align(sizeof(header));
+            for (uint32_t i = 0; i < Column::COUNT; ++i) {
+                header.columns[i] = offset;
+                offset = align(offset + header.rows * tick_store::width[i]);
+            }
+            
+            std::string bytes;
+            for (auto string : strings) {
+                auto length = static_cast<uint32_t>(string->size());
+                bytes.append(reinterpret_cast<const char *>(&length), sizeof(length));
+                bytes.append(*string);
+            }
+            header.strings_offset = offset;
+            header.index_offset = align(offset + bytes.size());
+            
+            std::vector<tick_store::Block> index;
+            for (size_t begin = 0; begin < size(); begin += block_rows) {
+                auto end = std::min(size(), begin + block_rows);
+                auto [min, max] = std::minmax_element(times[0].begin() + begin, times[0].begin() + end);
+                index.push_back(tick_store::Block { *min, *max });
+            }
+            
+            std::FILE * file = std::fopen(path, "wb");
+            if (!file) {
+                return false;
+            }
+            
+            uint64_t position = 0;
+            auto write = [file, &position] (uint64_t at, const void * data, size_t size) {
+                static const char zeros[64] = {};
+                bool ok = true;
+                for (; position < at; ++position) {
+                    ok &= std::fwrite(zeros, 1, 1, file) == 1;
+                }
+                position += size;
+                return ok && std::fwrite(data, 1, size, file) == size;
+            };
+            
+            bool ok = write(0, &header, sizeof(header));
+            for (uint32_t i = 0; i < Column::COUNT; ++i) {
+                ok = ok && write(header.columns[i], column(static_cast<Column>(i)), header.rows * tick_store::width[i]);
+            }
+            ok = ok && write(header.strings_offset, bytes.data(), bytes.size());
+            ok = ok && write(header.index_offset, index.data(), index.size() * sizeof(tick_store::Block));
+            
+            return std::fclose(file) == 0 && ok;
+        }
+    };
+
+    // A tick store file mapped read-only; the columns are used in place.
+    // False if the file can't be mapped or isn't a tick store.
+    class TickStore {
+        using Column = tick_store::Column;
+        
+        util::MappedFile file;
+        const tick_store::Header * header;
+        std::vector<std::string_view> strings;
+        
+        template <typename T>
+        const T * column(Column column) const {
+            return reinterpret_cast<const T *>(file.data() + header->columns[column]);
+        }
+        
+        bool valid() const {
+            if (file.size() < sizeof(tick_store::Header)) {
+                return false;
+            }
+            auto header = reinterpret_cast<const tick_store::Header *>(file.data());
+            if (std::memcmp(header->magic, tick_store::magic, sizeof(header->magic)) || header->version != tick_store::version || !header->block_rows) {
+                return false;
+            }
+            for (uint32_t i = 0; i < Column::COUNT; ++i) {
+                if (header->columns[i] > file.size() || header->rows > (file.size() - header->columns[i]) / tick_store::width[i]) {
+                    return false;
+                }
+            }
+            auto blocks = (header->rows + header->block_rows - 1) / header->block_rows;
+            return header->strings_offset <= file.size() && header->index_offset <= file.size()
+                && blocks <= (file.size() - header->index_offset) / sizeof(tick_store::Block);
+        }
+    public:
+        explicit TickStore(const char * path): file(path, util::MappedFile::Access::NORMAL), header(nullptr) {
+            if (!valid()) {
+                return;
+            }
+            
+            header = reinterpret_cast<const tick_store::Header *>(file.data());
+            
+            auto at = header->strings_offset;
+            for (uint64_t i = 0; i < header->strings; ++i) {
+                uint32_t length;
+                if (at + sizeof(length) > header->index_offset) {
+                    header = nullptr;
+                    return;
+                }
+                std::memcpy(&length, file.data() + at, sizeof(length));
+                at += sizeof(length);
+                if (length > header->index_offset - at) {
+                    header = nullptr;
+                    return;
+                }
+                strings.emplace_back(file.data() + at, length);
+                at += length;
+            }
+            
+            // every id has to stand for one of the strings
+            for (auto ids : { symbols(), market_makers(), flags() }) {
+                if (!std::all_of(ids, ids + size(), [this] (uint32_t id) { return id < strings.size(); })) {
+                    header = nullptr;
+                    return;
+                }
+            }
+        }
+        
+        explicit operator bool() const { return header; }
+        size_t size() const { return header ? header->rows : 0; }
+        
+        const int64_t * event_times() const { return column<int64_t>(Column::EVENT_TIME); }
+        const int64_t * bid_times() const { return column<int64_t>(Column::BID_TIME); }
+        const int64_t * ask_times() const { return column<int64_t>(Column::ASK_TIME); }
+        const int64_t * bid_prices() const { return column<int64_t>(Column::BID_PRICE); }
+        const int64_t * ask_prices() const { return column<int64_t>(Column::ASK_PRICE); }
+        const uint32_t * bid_sizes() const { return column<uint32_t>(Column::BID_SIZE); }
+        const uint32_t * ask_sizes() const { return column<uint32_t>(Column::ASK_SIZE); }
+        const uint32_t * bid_counts() const { return column<uint32_t>(Column::BID_COUNT); }
+        const uint32_t * ask_counts() const { return column<uint32_t>(Column::ASK_COUNT); }
+        const uint32_t * symbols() const { return column<uint32_t>(Column::SYMBOL); }
+        const uint32_t * market_makers() const { return column<uint32_t>(Column::MARKET_MAKER); }
+        const uint32_t * flags() const { return column<uint32_t>(Column::FLAGS); }
+        const char * exchange_codes() const { return column<char>(Column::EXCHANGE_CODE); }
+        
+        // what an id in symbols(), market_makers() or flags() stands for
+        std::string_view string(uint32_t id) const { return strings[id]; }
+        
+        // Rows [first, last) of the blocks whose event times may fall in
+        // [from, to]; rows within a block aren't assumed to be in order.
+        std::pair<size_t, size_t> range(std::chrono::system_clock::time_point from, std::chrono::system_clock::time_point to) const {
+            if (!header) {
+                return { 0, 0 };
+            }
+            
+            auto index = reinterpret_cast<const tick_store::Block *>(file.data() + header->index_offset);
+            auto blocks = (size() + header->block_rows - 1) / header->block_rows;
+            auto lo = tick_store::nanos(from), hi = tick_store::nanos(to);
+            
+            size_t first = blocks, last = 0;
+            for (size_t i = 0; i < blocks; ++i) {
+                if (index[i].max_time >= lo && index[i].min_time <= hi) {
+                    first = std::min(first, i);
+                    last = i + 1;
+                }
+            }
+            
+            if (first >= last) {
+                return { 0, 0 };
+            }
+            return { first * header->block_rows, std::min<size_t>(size(), last * header->block_rows) };
+        }
+        
+        Move move(size_t i) const {
+            Move move;
+            move.event.time = tick_store::time(event_times()[i]);
+            move.event.symbol = string(symbols()[i]);
+            move.bid.time = tick_store::time(bid_times()[i]);
+            move.bid.price = Price::from_ticks(bid_prices()[i]);
+            move.bid.size = bid_sizes()[i];
+            move.bid.count = bid_counts()[i];
+            move.ask.time = tick_store::time(ask_times()[i]);
+            move.ask.price = Price::from_ticks(ask_prices()[i]);
+            move.ask.size = ask_sizes()[i];
+            move.ask.count = ask_counts()[i];
+            move.market.xcode = exchange_codes()[i];
+            move.market.market_maker = string(market_makers()[i]);
+            move.market.flags = string(flags()[i]);
+            return move;
+        }
+    };
+
+    // Converts a quotes CSV file to a tick store file once, so later runs
+    // can map it instead of parsing text. Returns the rows written, -1 if
+    // either file can't be opened (see errno); rows that don't parse are
+    // left out.
+    inline int64_t convert(const char * csv_path, const char * store_path, uint32_t block_rows = 4096) {
+        csv::MappedReader reader (csv_path);
+        if (!reader) {
+            return -1;
+        }
+        
+        TickStoreWriter writer (block_rows);
+        csv::MappedReader<>::Values values;
+        Move move;
+        
+        while (reader.read_next_line(values)) {
+            bool ok = false;
+            try {
+                ok = move.from(values);
+            } catch (const std::logic_error &) {}
+            
+            if (ok) {
+                writer.append(move);
+            }
+        }
+        
+        return writer.save(store_path) ? static_cast<int64_t>(writer.size()) : -1;
+    }
+
+}
+}
+
+#endif /* TickStore_hpp */
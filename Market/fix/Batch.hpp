@@ -0,0 +1,173 @@
+//
+//  Batch.hpp
+//  Market
+//
+//  Created by Blagovest on 14/12/20.
+//
+
+#ifndef Fix_Batch_hpp
+#define Fix_Batch_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Scanner.hpp"
+#include "Tag.hpp"
+
+namespace mkt {
+namespace fix {
+
+    // Every message of a buffer, parsed in one go into flat arrays (one
+    // entry per message, one per field) that get reused from batch to batch.
+    // Offsets are into buffer, which has to outlive the batch.
+    struct MessageBatch {
+        enum Status: uint8_t {
+            OK,
+            BAD_BODY_LENGTH,    // no 10= where BodyLength(9) says, or no BodyLength at all
+            BAD_CHECKSUM,       // CheckSum(10) doesn't match the bytes
+            TRUNCATED           // the buffer ends mid message
+        };
+        
+        std::string_view buffer;
+        
+        // per message; only OK and BAD_CHECKSUM messages have fields
+        std::vector<size_t> offsets;
+        std::vector<uint32_t> lengths;
+        std::vector<Status> statuses;
+        std::vector<std::string_view> msg_types;
+        std::vector<size_t> first_fields;
+        std::vector<uint32_t> field_counts;
+        
+        // per field, in message order
+        std::vector<int> tags;
+        std::vector<size_t> value_offsets;
+        std::vector<uint32_t> value_lengths;
+        
+        // bytes between messages, e.g. log line prefixes
+        uint64_t skipped = 0;
+        
+        size_t size() const { return offsets.size(); }
+        std::string_view message(size_t i) const { return buffer.substr(offsets[i], lengths[i]); }
+        std::string_view value(size_t field) const { return buffer.substr(value_offsets[field], value_lengths[field]); }
+        
+        void clear() {
+            offsets.clear();
+            lengths.clear();
+            statuses.clear();
+            msg_types.clear();
+            first_fields.clear();
+            field_counts.clear();
+            tags.clear();
+            value_offsets.clear();
+            value_lengths.clear();
+            skipped = 0;
+        }
+    };
+
+    // Parses all messages in buffer into batch, checking BodyLength and
+    // CheckSum on the way instead of throwing; a message with a bad
+    // BodyLength is skipped up to the next "8=FIX" and reported as such.
+    // Only the last message can be TRUNCATED, one whose BodyLength goes
+    // past the buffer while no "8=FIX" follows it.
+    inline void parse_batch(std::string_view buffer, MessageBatch & batch) {
+        constexpr char SOH = 0x1;
+        constexpr std::string_view begin_string = "8=FIX";
+        constexpr size_t npos = std::string_view::npos;
+        
+        batch.clear();
+        batch.buffer = buffer;
+        
+        auto data = buffer.data();
+        auto size = buffer.size();
+        
+        auto add = [&batch] (size_t offset, size_t length, MessageBatch::Status status) {
+            batch.offsets.push_back(offset);
+            batch.lengths.push_back(static_cast<uint32_t>(length));
+            batch.statuses.push_back(status);
+            batch.msg_types.emplace_back();
+            batch.first_fields.push_back(batch.tags.size());
+            batch.field_counts.push_back(0);
+        };
+        
+        size_t position = 0;
+        
+        while (position < size) {
+            auto start = buffer.find(begin_string, position);
+            
+            if (start == npos) {
+                batch.skipped += size - position;
+                break;
+            }
+            
+            batch.skipped += start - position;
+            
+            // 8=...<SOH>9=digits<SOH>
+            auto begin_string_end = buffer.find(SOH, start);
+            auto body_length = begin_string_end + 1;
+            auto body_length_end = begin_string_end == npos ? npos : buffer.find(SOH, body_length);
+            
+            if (body_length_end == npos) {
+                add(start, size - start, MessageBatch::TRUNCATED);
+                break;
+            }
+            
+            size_t length = 0;
+            bool digits = body_length_end > body_length + 2 && body_length_end <= body_length + 11 && data[body_length] == '9' && data[body_length + 1] == '=';
+            
+            for (auto i = body_length + 2; digits && i < body_length_end; ++i) {
+                digits = data[i] >= '0' && data[i] <= '9';
+                length = 10 * length + (data[i] - '0');
+            }
+            
+            // the body is followed by 10=NNN<SOH>
+            auto trailer = body_length_end + 1 + length;
+            auto end = trailer + 7;
+            
+            if (!digits || end > size || buffer.compare(trailer, 3, "10=") || data[end - 1] != SOH) {
+                auto next = buffer.find(begin_string, start + 1);
+                
+                // past the end with nothing after it is a message still to
+                // come; with another message after it, a bad BodyLength
+                if (digits && end > size && next == npos) {
+                    add(start, size - start, MessageBatch::TRUNCATED);
+                    break;
+                }
+                
+                position = next == npos ? size : next;
+                add(start, position - start, MessageBatch::BAD_BODY_LENGTH);
+                continue;
+            }
+            
+            add(start, end - start, MessageBatch::OK);
+            
+            auto sum = scanner::scan(data + start, end - start, [&batch, data, start] (int tag, size_t, size_t value, size_t value_end) {
+                batch.tags.push_back(tag);
+                batch.value_offsets.push_back(start + value);
+                batch.value_lengths.push_back(static_cast<uint32_t>(value_end - value));
+                
+                if (tag == Tag::MsgType && batch.msg_types.back().empty()) {
+                    batch.msg_types.back() = std::string_view(data + start + value, value_end - value);
+                }
+            });
+            
+            batch.field_counts.back() = static_cast<uint32_t>(batch.tags.size() - batch.first_fields.back());
+            
+            unsigned checksum = 0;
+            for (auto i = trailer + 3; i < end - 1; ++i) {
+                checksum = 10 * checksum + (data[i] - '0');
+            }
+            
+            if (checksum != sum) {
+                batch.statuses.back() = MessageBatch::BAD_CHECKSUM;
+            }
+            
+            position = end;
+        }
+    }
+
+}
+}
+
+#endif /* Batch_hpp */
@@ -0,0 +1,237 @@
+//
+//  Encoder.hpp
+//  Market
+//
+//  Created by Blagovest on 16/12/20.
+//
+
+#ifndef Fix_Encoder_hpp
+#define Fix_Encoder_hpp
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "Fields.hpp"
+#include "../util/Time.hpp"
+
+namespace mkt {
+namespace fix {
+
+    class Fragment;
+    class Encoder;
+
+namespace encoding {
+
+    constexpr char SOH = 0x1;
+
+    // room any value but a String needs, UTCTimestamp being the longest;
+    // a tag=...<SOH> adds up to 13 more
+    constexpr size_t max_value = 32;
+
+    inline char * write(char * out, std::string_view value) {
+        std::memcpy(out, value.data(), value.size());
+        return out + value.size();
+    }
+
+    inline char * write(char * out, Char value) {
+        *out = value;
+        return out + 1;
+    }
+
+    inline char * write(char * out, Boolean value) {
+        *out = value ? 'Y' : 'N';
+        return out + 1;
+    }
+
+    template <typename Integer, typename = std::enable_if_t<std::is_integral_v<Integer>>>
+    char * write(char * out, Integer value) {
+        return std::to_chars(out, out + max_value, value).ptr;
+    }
+
+    template <unsigned Decimals, typename Rep>
+    char * write(char * out, util::FixedPrice<Decimals, Rep> value) {
+        return util::to_chars(out, out + max_value, value).ptr;
+    }
+
+    inline char * two(char * out, unsigned value) {
+        out[0] = static_cast<char>('0' + value / 10);
+        out[1] = static_cast<char>('0' + value % 10);
+        return out + 2;
+    }
+
+    // YYYYMMDD-HH:MM:SS.sss
+    inline char * write(char * out, UTCTimestamp value) {
+        auto nanos = value.time_since_epoch().count();
+        auto seconds = nanos / 1000000000 - (nanos % 1000000000 < 0);
+        auto millis = static_cast<unsigned>((nanos - seconds * 1000000000) / 1000000);
+        auto days = seconds / 86400 - (seconds % 86400 < 0);
+        auto time = static_cast<unsigned>(seconds - days * 86400);
+        auto date = util::civil_from_days(days);
+        
+        out = two(two(out, static_cast<unsigned>(date.year / 100)), static_cast<unsigned>(date.year % 100));
+        out = two(two(out, date.month), date.day);
+        *out++ = '-';
+        out = two(out, time / 3600);
+        *out++ = ':';
+        out = two(out, time / 60 % 60);
+        *out++ = ':';
+        out = two(out, time % 60);
+        *out++ = '.';
+        *out++ = static_cast<char>('0' + millis / 100);
+        return two(out, millis % 100);
+    }
+
+    template <typename Value>
+    size_t room(const Value & value) {
+        if constexpr (std::is_convertible_v<const Value &, std::string_view>) {
+            return std::string_view(value).size();
+        } else {
+            return max_value;
+        }
+    }
+
+    // tag=value<SOH> at out, returns where it ends
+    template <typename Value>
+    char * field(char * out, int tag, const Value & value) {
+        out = write(out, tag);
+        *out++ = '=';
+        if constexpr (std::is_convertible_v<const Value &, std::string_view>) {
+            out = write(out, std::string_view(value));
+        } else {
+            out = write(out, value);
+        }
+        *out++ = SOH;
+        return out;
+    }
+
+    inline uint32_t sum(const char * begin, const char * end) {
+        uint32_t sum = 0;
+        for (; begin != end; ++begin) {
+            sum += static_cast<unsigned char>(*begin);
+        }
+        return sum;
+    }
+
+}
+
+    // A run of fields encoded once and then copied into any number of
+    // messages along with its byte sum, e.g. 35=D|49=SENDER|56=TARGET|
+    // that's the same for every order on a session.
+    class Fragment {
+        std::string bytes;
+        uint32_t _sum;
+    public:
+        Fragment(): bytes(), _sum() {}
+        
+        template <typename Value>
+        Fragment & field(int tag, const Value & value) {
+            auto size = bytes.size();
+            bytes.resize(size + encoding::room(value) + 13);
+            auto end = encoding::field(bytes.data() + size, tag, value);
+            _sum += encoding::sum(bytes.data() + size, end);
+            bytes.resize(end - bytes.data());
+            return *this;
+        }
+        
+        std::string_view view() const { return bytes; }
+        uint32_t sum() const { return _sum; }
+    };
+
+    // Encodes one message at a time into a caller's buffer, with no
+    // allocation and no copying afterwards. The body is written first,
+    // after room left for the longest 8=...|9=...| header; finish() then
+    // writes the header right up against the body, so BodyLength never
+    // needs padding and nothing is moved. The CheckSum is summed up as
+    // fields are written. Running out of buffer sets overflow() and makes
+    // finish() return an empty view.
+    class Encoder {
+        static constexpr size_t max_body_length_digits = 7;
+        
+        char * buffer;
+        size_t capacity;
+        std::string_view begin_string;
+        size_t body;
+        size_t position;
+        uint32_t sum;
+        bool _overflow;
+        
+        bool fits(size_t size) {
+            _overflow = _overflow || capacity - position < size;
+            return !_overflow;
+        }
+    public:
+        Encoder(char * buffer, size_t capacity, std::string_view begin_string = "FIX.4.2"): buffer(buffer), capacity(capacity), begin_string(begin_string), body(begin_string.size() + 6 + max_body_length_digits), position(), sum(), _overflow() {
+            reset();
+        }
+        
+        // starts over on the next message, reusing the buffer
+        void reset() {
+            _overflow = body > capacity;
+            position = std::min(body, capacity);
+            sum = 0;
+        }
+        
+        template <typename Value>
+        Encoder & field(int tag, const Value & value) {
+            if (fits(encoding::room(value) + 13)) {
+                auto start = buffer + position;
+                auto end = encoding::field(start, tag, value);
+                sum += encoding::sum(start, end);
+                position = end - buffer;
+            }
+            return *this;
+        }
+        
+        Encoder & append(const Fragment & fragment) {
+            auto bytes = fragment.view();
+            if (fits(bytes.size())) {
+                std::memcpy(buffer + position, bytes.data(), bytes.size());
+                sum += fragment.sum();
+                position += bytes.size();
+            }
+            return *this;
+        }
+        
+        // writes the header and trailer, returns the whole message; it
+        // stays valid until the next reset() or until buffer is reused
+        std::string_view finish() {
+            if (!fits(7) || position - body > 9999999) {
+                _overflow = true;
+                return {};
+            }
+            
+            char length[max_body_length_digits];
+            auto length_end = std::to_chars(length, length + max_body_length_digits, position - body).ptr;
+            auto header_size = 2 + begin_string.size() + 1 + 2 + (length_end - length) + 1;
+            auto start = buffer + body - header_size;
+            
+            auto out = encoding::write(start, std::string_view("8="));
+            out = encoding::write(out, begin_string);
+            *out++ = encoding::SOH;
+            out = encoding::write(out, std::string_view("9="));
+            out = encoding::write(out, std::string_view(length, length_end - length));
+            *out++ = encoding::SOH;
+            
+            auto checksum = (sum + encoding::sum(start, out)) % 256;
+            out = buffer + position;
+            out = encoding::write(out, std::string_view("10="));
+            *out++ = static_cast<char>('0' + checksum / 100);
+            out = encoding::two(out, checksum % 100);
+            *out++ = encoding::SOH;
+            
+            return std::string_view(start, out - start);
+        }
+        
+        bool overflow() const { return _overflow; }
+    };
+
+}
+}
+
+#endif /* Encoder_hpp */
@@ -0,0 +1,147 @@
+//
+//  Fields.hpp
+//  Market
+//
+//  Created by Blagovest on 15/12/20.
+//
+
+#ifndef Fix_Fields_hpp
+#define Fix_Fields_hpp
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "Tag.hpp"
+#include "../util/FixedPrice.hpp"
+#include "../util/Time.hpp"
+
+namespace mkt {
+namespace fix {
+
+    // FIX data types, as decoded
+    using Int = int64_t;
+    using Qty = int64_t; // whole quantities only
+    using Price = util::FixedPrice<8>;
+    using Char = char;
+    using Boolean = bool;
+    using String = std::string_view;
+    using UTCTimestamp = std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
+
+    // Decodes a raw value; nullopt if it isn't a valid T. Nothing here
+    // allocates or copies the value.
+    template <typename T>
+    struct decoder;
+
+    template <>
+    struct decoder<Int> {
+        std::optional<Int> operator() (std::string_view value) const noexcept {
+            Int result;
+            auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), result);
+            return error == std::errc() && end == value.data() + value.size() ? std::optional(result) : std::nullopt;
+        }
+    };
+
+    template <>
+    struct decoder<Price> {
+        std::optional<Price> operator() (std::string_view value) const noexcept {
+            Price result;
+            auto [end, error] = util::from_chars(value.data(), value.data() + value.size(), result);
+            return error == std::errc() && end == value.data() + value.size() ? std::optional(result) : std::nullopt;
+        }
+    };
+
+    template <>
+    struct decoder<Char> {
+        std::optional<Char> operator() (std::string_view value) const noexcept {
+            return value.size() == 1 ? std::optional(value[0]) : std::nullopt;
+        }
+    };
+
+    template <>
+    struct decoder<Boolean> {
+        std::optional<Boolean> operator() (std::string_view value) const noexcept {
+            return value == "Y" ? std::optional(true) : value == "N" ? std::optional(false) : std::nullopt;
+        }
+    };
+
+    template <>
+    struct decoder<String> {
+        std::optional<String> operator() (std::string_view value) const noexcept {
+            return value;
+        }
+    };
+
+    // YYYYMMDD-HH:MM:SS with optional .sss, .ssssss or .sssssssss, always UTC
+    template <>
+    struct decoder<UTCTimestamp> {
+        std::optional<UTCTimestamp> operator() (std::string_view value) const noexcept {
+            using util::digits;
+            using util::all_digits;
+            
+            auto data = value.data();
+            auto fraction = value.size() > 17 ? static_cast<unsigned>(value.size() - 18) : 0;
+            
+            if (value.size() < 17 || data[8] != '-' || data[11] != ':' || data[14] != ':'
+                || !all_digits(data, 8) || !all_digits(data + 9, 2) || !all_digits(data + 12, 2) || !all_digits(data + 15, 2)) {
+                return std::nullopt;
+            }
+            
+            if (value.size() > 17 && (data[17] != '.' || (fraction != 3 && fraction != 6 && fraction != 9) || !all_digits(data + 18, fraction))) {
+                return std::nullopt;
+            }
+            
+            auto days = util::days_from_civil(digits(data, 4), digits(data + 4, 2), digits(data + 6, 2));
+            auto seconds = (days * 24 + digits(data + 9, 2)) * 3600 + digits(data + 12, 2) * 60 + digits(data + 15, 2);
+            int64_t nanos = fraction ? digits(data + 18, fraction) : 0;
+            
+            for (auto i = fraction; i < 9; ++i) {
+                nanos *= 10;
+            }
+            
+            return UTCTimestamp(std::chrono::nanoseconds(seconds * 1000000000 + nanos));
+        }
+    };
+
+    // The decoded type of each tag's value; anything not listed is a String.
+    // Specialize for more tags as they're needed.
+    template <int Id>
+    struct field_type {
+        using type = String;
+    };
+
+    template <int Id>
+    using field_type_t = typename field_type<Id>::type;
+
+    template <> struct field_type<6> { using type = Price; };           // AvgPx
+    template <> struct field_type<14> { using type = Qty; };            // CumQty
+    template <> struct field_type<31> { using type = Price; };          // LastPx
+    template <> struct field_type<32> { using type = Qty; };            // LastQty
+    template <> struct field_type<34> { using type = Int; };            // MsgSeqNum
+    template <> struct field_type<38> { using type = Qty; };            // OrderQty
+    template <> struct field_type<39> { using type = Char; };           // OrdStatus
+    template <> struct field_type<40> { using type = Char; };           // OrdType
+    template <> struct field_type<43> { using type = Boolean; };        // PossDupFlag
+    template <> struct field_type<44> { using type = Price; };          // Price
+    template <> struct field_type<52> { using type = UTCTimestamp; };   // SendingTime
+    template <> struct field_type<54> { using type = Char; };           // Side
+    template <> struct field_type<59> { using type = Char; };           // TimeInForce
+    template <> struct field_type<60> { using type = UTCTimestamp; };   // TransactTime
+    template <> struct field_type<97> { using type = Boolean; };        // PossResend
+    template <> struct field_type<99> { using type = Price; };          // StopPx
+    template <> struct field_type<108> { using type = Int; };           // HeartBtInt
+    template <> struct field_type<150> { using type = Char; };          // ExecType
+    template <> struct field_type<151> { using type = Qty; };           // LeavesQty
+
+    template <int Id>
+    std::optional<field_type_t<Id>> decode(std::string_view value) noexcept {
+        static_assert(known(Id), "not a FIX tag");
+        return decoder<field_type_t<Id>>()(value);
+    }
+
+}
+}
+
+#endif /* Fields_hpp */
@@ -0,0 +1,197 @@
+//
+//  Framer.hpp
+//  Market
+//
+//  Created by Blagovest on 13/12/20.
+//
+
+#ifndef Fix_Framer_hpp
+#define Fix_Framer_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string_view>
+
+namespace mkt {
+namespace fix {
+
+    // Splits a FIX byte stream into whole messages. Bytes go straight into
+    // the framer's own buffer (recv() into prepare(), then commit()), and
+    // messages come out as views into that buffer, so nothing is copied
+    // per message. Boundaries come from the header alone:
+    //     8=BeginString<SOH>9=BodyLength<SOH>...body...10=NNN<SOH>
+    // and a message split across reads is picked up where it was left,
+    // never re-scanned. On garbage the framer skips ahead to the next "8=FIX".
+    //
+    // The buffer is linear rather than a ring so a message is always one
+    // contiguous view; consumed bytes are reclaimed by moving the (short)
+    // unread tail to the front, which is also why views only stay valid
+    // until the next prepare() or feed().
+    class Framer {
+        static constexpr char SOH = 0x1;
+        static constexpr std::string_view begin_string = "8=FIX";
+        // "10=" three digits and SOH
+        static constexpr size_t trailer_length = 7;
+        // longest BeginString or BodyLength value we look at before giving up
+        static constexpr size_t max_header_value = 16;
+        
+        std::unique_ptr<char[]> buffer;
+        size_t capacity;
+        size_t head, tail;
+        // total length of the message at head once its header is in, else 0
+        size_t expected;
+        uint64_t _dropped;
+        
+        // skips the message at head and anything up to the next one
+        void resync() {
+            expected = 0;
+            
+            auto view = std::string_view(buffer.get() + head, tail - head);
+            auto next = view.find(begin_string, 1);
+            
+            if (next == std::string_view::npos) {
+                // keep what could be the start of the next message, cut off at the end
+                auto prefix = begin_string.size() - 1;
+                next = view.size() > prefix ? view.size() - prefix : 1;
+            }
+            
+            head += next;
+            _dropped += next;
+        }
+        
+        // reads a SOH terminated value at position, returns its end or 0 if
+        // it's not all there yet, npos if it never will be
+        size_t value_end(size_t position) const {
+            auto available = std::min(tail - position, max_header_value + 1);
+            auto soh = static_cast<const char *>(std::memchr(buffer.get() + position, SOH, available));
+            
+            if (soh) {
+                return soh - buffer.get();
+            }
+            
+            return available > max_header_value ? std::string_view::npos : 0;
+        }
+        
+        // sets expected once the whole header at head is in (until then
+        // it stays 0); false if that isn't a valid message header
+        bool frame() {
+            auto data = buffer.get();
+            
+            if (tail - head < begin_string.size()) {
+                return true;
+            }
+            
+            if (std::string_view(data + head, begin_string.size()) != begin_string) {
+                return false;
+            }
+            
+            auto begin_string_end = value_end(head + 2);
+            if (!begin_string_end || begin_string_end == std::string_view::npos) {
+                return begin_string_end != std::string_view::npos;
+            }
+            
+            auto body_length = begin_string_end + 1;
+            if (tail - body_length < 2) {
+                return true;
+            }
+            
+            if (data[body_length] != '9' || data[body_length + 1] != '=') {
+                return false;
+            }
+            
+            auto body_length_end = value_end(body_length + 2);
+            if (!body_length_end || body_length_end == std::string_view::npos) {
+                return body_length_end != std::string_view::npos;
+            }
+            
+            size_t length = 0;
+            
+            for (auto i = body_length + 2; i < body_length_end; ++i) {
+                if (data[i] < '0' || data[i] > '9') {
+                    return false;
+                }
+                length = 10 * length + (data[i] - '0');
+            }
+            
+            expected = body_length_end + 1 - head + length + trailer_length;
+            return body_length_end > body_length + 2 && expected <= capacity;
+        }
+    public:
+        Framer(size_t capacity = 1 << 16): buffer(std::make_unique<char[]>(capacity)), capacity(capacity), head(), tail(), expected(), _dropped() {}
+        
+        Framer(const Framer & framer) = delete;
+        
+        // where the next read should go, at least available() bytes;
+        // invalidates the views handed out so far
+        char * prepare() {
+            if (head == tail) {
+                head = tail = 0;
+            } else if (head) {
+                std::memmove(buffer.get(), buffer.get() + head, tail - head);
+                tail -= head;
+                head = 0;
+            }
+            
+            return buffer.get() + tail;
+        }
+        
+        size_t available() const {
+            return capacity - tail;
+        }
+        
+        // marks size bytes written at prepare() as received
+        void commit(size_t size) {
+            tail += size;
+        }
+        
+        // copies in as much of data as fits, returns how much that was
+        size_t feed(const char * data, size_t size) {
+            auto target = prepare();
+            auto count = std::min(size, available());
+            std::memcpy(target, data, count);
+            commit(count);
+            return count;
+        }
+        
+        // the next complete message, if there is one
+        bool next(std::string_view & message) {
+            while (head != tail) {
+                if (!expected && !frame()) {
+                    resync();
+                    continue;
+                }
+                
+                if (!expected || tail - head < expected) {
+                    return false;
+                }
+                
+                auto data = buffer.get() + head;
+                auto trailer = data + expected - trailer_length;
+                
+                if (std::memcmp(trailer, "10=", 3) || data[expected - 1] != SOH) {
+                    resync();
+                    continue;
+                }
+                
+                message = std::string_view(data, expected);
+                head += expected;
+                expected = 0;
+                return true;
+            }
+            
+            return false;
+        }
+        
+        // bytes received but not yet handed out as a message
+        size_t pending() const { return tail - head; }
+        // bytes skipped over while looking for a message start
+        uint64_t dropped() const { return _dropped; }
+    };
+
+}
+}
+
+#endif /* Framer_hpp */
@@ -0,0 +1,310 @@
+//
+//  Groups.hpp
+//  Market
+//
+//  Created by Blagovest on 17/12/20.
+//
+
+#ifndef Fix_Groups_hpp
+#define Fix_Groups_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+
+namespace mkt {
+namespace fix {
+
+    // What makes up a repeating group: its NoXXX count tag and the tags an
+    // entry may hold (nested count tags included). The first tag after the
+    // count is the delimiter that starts every entry, as FIX has it, so it
+    // doesn't need to be listed apart.
+    struct GroupSpec {
+        int count;
+        const int * members;
+        size_t size;
+        
+        constexpr bool member(int tag) const {
+            for (size_t i = 0; i < size; ++i) {
+                if (members[i] == tag) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    template <int Count, int... Members>
+    struct Group {
+        static constexpr int members[] = { Members... };
+        static constexpr GroupSpec spec { Count, members, sizeof...(Members) };
+    };
+
+    template <typename... Groups>
+    struct GroupDictionary {
+        static constexpr GroupSpec specs[] = { Groups::spec... };
+        
+        static constexpr const GroupSpec * find(int count) {
+            for (auto & spec : specs) {
+                if (spec.count == count) {
+                    return &spec;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    // Parties(453) and their PartySubIDs(802)
+    using PartyGroup = Group<453, 448, 447, 452, 802>;
+    using PartySubGroup = Group<802, 523, 803>;
+
+    // MDEntries(268) of 35=W/X, MDReqGrp(267) and RelatedSym(146) of 35=V
+    using MDEntriesGroup = Group<268,
+        269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+        290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 336, 346, 387, 451, 625, 1023, 1070, 83, 37, 198, 58, 354, 355,
+        55, 65, 48, 22, 207, 15, 64, 63, 126, 110, 18, 326, 327, 453>;
+    using MDEntryTypesGroup = Group<267, 269>;
+    using RelatedSymGroup = Group<146, 55, 65, 48, 22, 460, 461, 167, 200, 541, 201, 202, 206, 231, 223, 207, 106, 107, 15, 555, 711>;
+
+    using MarketDataGroups = GroupDictionary<MDEntriesGroup, MDEntryTypesGroup, RelatedSymGroup, PartyGroup, PartySubGroup>;
+
+    // Like IndexedStoragePolicy, (tag, offset, length) entries in one flat
+    // inline array, but aware of repeating groups: each group is a range of
+    // entries and each entry a range of fields in that same array, so
+    // walking thousands of MD entries is a linear pass with no allocation.
+    // An entry ends at the next delimiter or at the first tag that's not a
+    // member of its group; groups nest as deep as MaxDepth. Whatever doesn't
+    // fit in the capacities is dropped and flagged by overflow().
+    template <typename String, typename Groups = MarketDataGroups, size_t Capacity = 1024, size_t GroupCapacity = 64, size_t MaxDepth = 4>
+    class GroupedStoragePolicy {
+        using Iterator = typename String::const_iterator;
+        using Index = uint32_t;
+        
+        static constexpr Index npos = std::numeric_limits<Index>::max();
+    public:
+        struct Field {
+            int tag;
+            uint32_t offset;
+            uint32_t length;
+        };
+        
+        class Entry;
+        class GroupView;
+    private:
+        // fields [begin, end) of one entry, starting with the delimiter;
+        // entries of nested groups come in between, hence the link to the
+        // next entry of the same group
+        struct Instance {
+            Index begin, end, next;
+        };
+        
+        struct GroupRecord {
+            int tag;
+            int delimiter;
+            uint32_t declared;
+            Index first, last, count; // its instances
+            Index parent;       // instance it's nested in, npos at the top
+        };
+        
+        struct Open {
+            const GroupSpec * spec;
+            Index group;
+        };
+        
+        Iterator base;
+        // only the first count elements of each are ever read
+        std::array<Field, Capacity> fields;
+        std::array<Instance, Capacity> instances;
+        std::array<GroupRecord, GroupCapacity> groups;
+        std::array<Open, MaxDepth> open;
+        Index field_count, instance_count, group_count, depth;
+        bool _overflow;
+        
+        void close(const Open & current) {
+            auto & group = groups[current.group];
+            _overflow |= group.count != group.declared;
+        }
+        
+        bool belongs(const Open & current, int tag) const {
+            auto & group = groups[current.group];
+            return tag == group.delimiter || group.delimiter == 0 || current.spec->member(tag);
+        }
+        
+        static uint32_t number(Iterator start, Iterator end) {
+            uint32_t value = 0;
+            for (; start != end; ++start) {
+                value = 10 * value + static_cast<uint32_t>(*start - '0');
+            }
+            return value;
+        }
+        
+        GroupView find_group(int tag, Index parent) const {
+            for (Index i = 0; i < group_count; ++i) {
+                if (groups[i].tag == tag && groups[i].parent == parent) {
+                    return GroupView(this, groups[i].first, groups[i].count);
+                }
+            }
+            return GroupView(this, npos, 0);
+        }
+
+    public:
+        GroupedStoragePolicy(const String & message): base(message.begin()), field_count(), instance_count(), group_count(), depth(), _overflow(false) {}
+        
+        void store(int tag, Iterator start, Iterator end) {
+            // leave the groups this tag isn't part of
+            while (depth && !belongs(open[depth - 1], tag)) {
+                close(open[--depth]);
+            }
+            
+            if (field_count == Capacity) {
+                _overflow = true;
+                return;
+            }
+            
+            auto index = field_count++;
+            fields[index] = Field { tag, static_cast<uint32_t>(std::distance(base, start)), static_cast<uint32_t>(std::distance(start, end)) };
+            
+            if (depth) {
+                auto & group = groups[open[depth - 1].group];
+                
+                if (!group.delimiter) {
+                    group.delimiter = tag;
+                }
+                
+                if (tag == group.delimiter) {
+                    if (instance_count == Capacity) {
+                        _overflow = true;
+                    } else {
+                        instances[instance_count] = Instance { index, index, npos };
+                        (group.count ? instances[group.last].next : group.first) = instance_count;
+                        group.last = instance_count++;
+                        ++group.count;
+                    }
+                }
+                
+                // every open group's current entry grows with the field
+                for (Index i = 0; i < depth; ++i) {
+                    auto & open_group = groups[open[i].group];
+                    if (open_group.count) {
+                        instances[open_group.last].end = index + 1;
+                    }
+                }
+            }
+            
+            if (auto spec = Groups::find(tag)) {
+                if (group_count == GroupCapacity || depth == MaxDepth) {
+                    _overflow = true;
+                    return;
+                }
+                
+                Index parent = npos;
+                if (depth) {
+                    auto & outer = groups[open[depth - 1].group];
+                    parent = outer.count ? outer.last : npos;
+                }
+                
+                auto declared = number(start, end);
+                groups[group_count] = GroupRecord { tag, 0, declared, npos, npos, 0, parent };
+                // an empty group has no delimiter to wait for
+                if (declared) {
+                    open[depth++] = Open { spec, group_count };
+                }
+                ++group_count;
+            }
+        }
+        
+        String value(const Field & field) const {
+            return String(base + field.offset, field.length);
+        }
+        
+        // the first field with this tag, anywhere in the message
+        std::optional<String> get(int tag) const {
+            for (Index i = 0; i < field_count; ++i) {
+                if (fields[i].tag == tag) {
+                    return value(fields[i]);
+                }
+            }
+            return std::nullopt;
+        }
+        
+        // a top level group, empty if the message doesn't have it
+        GroupView group(int tag) const {
+            return find_group(tag, npos);
+        }
+        
+        const Field * begin() const { return fields.data(); }
+        const Field * end() const { return fields.data() + field_count; }
+        size_t size() const { return field_count; }
+        
+        // something didn't fit, or a group had fewer or more entries than it said
+        bool overflow() const {
+            bool mismatch = false;
+            for (Index i = 0; i < depth; ++i) {
+                mismatch |= groups[open[i].group].count != groups[open[i].group].declared;
+            }
+            return _overflow || mismatch;
+        }
+        
+        class Entry {
+            const GroupedStoragePolicy * storage;
+            Index instance;
+        public:
+            Entry(const GroupedStoragePolicy * storage, Index instance): storage(storage), instance(instance) {}
+            
+            const Field * begin() const { return storage->fields.data() + storage->instances[instance].begin; }
+            const Field * end() const { return storage->fields.data() + storage->instances[instance].end; }
+            
+            std::optional<String> get(int tag) const {
+                for (auto & field : *this) {
+                    if (field.tag == tag) {
+                        return storage->value(field);
+                    }
+                }
+                return std::nullopt;
+            }
+            
+            // a group nested in this entry
+            GroupView group(int tag) const {
+                return storage->find_group(tag, instance);
+            }
+        };
+        
+        class GroupView {
+            const GroupedStoragePolicy * storage;
+            Index first, count;
+        public:
+            class iterator {
+                const GroupedStoragePolicy * storage;
+                Index instance;
+            public:
+                iterator(const GroupedStoragePolicy * storage, Index instance): storage(storage), instance(instance) {}
+                Entry operator * () const { return Entry(storage, instance); }
+                iterator & operator ++ () { instance = storage->instances[instance].next; return *this; }
+                bool operator != (const iterator & other) const { return instance != other.instance; }
+            };
+            
+            GroupView(const GroupedStoragePolicy * storage, Index first, Index count): storage(storage), first(first), count(count) {}
+            
+            iterator begin() const { return iterator(storage, first); }
+            iterator end() const { return iterator(storage, npos); }
+            size_t size() const { return count; }
+            bool empty() const { return !count; }
+            
+            // walks the links, so better iterate than index in a loop
+            Entry operator [] (size_t i) const {
+                auto instance = first;
+                while (i--) {
+                    instance = storage->instances[instance].next;
+                }
+                return Entry(storage, instance);
+            }
+        };
+    };
+
+}
+}
+
+#endif /* Groups_hpp */
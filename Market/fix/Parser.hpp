@@ -12,8 +12,14 @@
 #include <map>
 #include <vector>
 #include <list>
+#include <array>
+#include <optional>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
 
 #include "Tag.hpp"
+#include "Scanner.hpp"
 
 namespace mkt {
 namespace fix {
@@ -53,7 +59,25 @@ namespace fix {
         StoragePolicy storage;
         LengthCalculator length_calc;
         
+        // contiguous messages are scanned a block at a time when the CPU
+        // has SIMD; the length calculator then only sees each field's start
+        static constexpr bool contiguous = std::is_same_v<String, std::string_view> || std::is_same_v<String, std::string>;
+        
         void parse(const String & message) {
+            if constexpr (contiguous) {
+                if (scanner::vectorized()) {
+                    _checksum = scanner::scan(message.data(), message.size(), [this, &message] (int tag, size_t start, size_t value, size_t end) {
+                        length_calc.count(message.begin() + start, tag);
+                        storage.store(tag, message.begin() + value, message.begin() + end);
+                    });
+                    return;
+                }
+            }
+            
+            parse_bytes(message);
+        }
+        
+        void parse_bytes(const String & message) {
             auto cur = message.begin();
             while (cur != message.end()) {
                 unsigned char sum = 0;
@@ -93,6 +117,7 @@ namespace fix {
         
         size_t length() const { return length_calc.length(); }
         unsigned char checksum() const { return _checksum; }
+        const StoragePolicy & fields() const { return storage; }
     };
 
     template <typename String, typename Map = std::map<int, String>>
@@ -125,6 +150,99 @@ namespace fix {
         }
     };
 
+    // Keeps a (tag, offset, length) entry per field in a fixed inline array
+    // instead of copying values out, so parsing a message never allocates;
+    // the message has to outlive the storage. The hot tags are also indexed
+    // directly, anything else is a scan over at most Capacity entries.
+    // Fields past Capacity are dropped and flagged by overflow().
+    template <typename String, size_t Capacity = 64>
+    class IndexedStoragePolicy {
+        static_assert(Capacity < 256, "hot tag indices are a byte");
+        
+        using Iterator = typename String::const_iterator;
+    public:
+        struct Field {
+            int tag;
+            uint32_t offset;
+            uint32_t length;
+        };
+        
+        // MsgType, SenderCompID, TargetCompID, MsgSeqNum, OrderQty, Price, Side, Symbol
+        static constexpr int hot_tags[] = { 35, 49, 56, 34, 38, 44, 54, 55 };
+    private:
+        static constexpr int hot(int tag) noexcept {
+            switch (tag) {
+                case 35: return 0;
+                case 49: return 1;
+                case 56: return 2;
+                case 34: return 3;
+                case 38: return 4;
+                case 44: return 5;
+                case 54: return 6;
+                case 55: return 7;
+                default: return -1;
+            }
+        }
+        
+        Iterator base;
+        // only the first count entries are ever read, so no need to clear it
+        std::array<Field, Capacity> entries;
+        // 1 + position in entries of the first occurrence, 0 if absent
+        std::array<uint8_t, std::size(hot_tags)> hot_index;
+        size_t count;
+        bool _overflow;
+    public:
+        IndexedStoragePolicy(const String & message): base(message.begin()), hot_index(), count(), _overflow(false) {}
+        
+        void store(int tag, Iterator start, Iterator end) {
+            if (count == Capacity) {
+                _overflow = true;
+                return;
+            }
+            
+            entries[count++] = Field { tag, static_cast<uint32_t>(std::distance(base, start)), static_cast<uint32_t>(std::distance(start, end)) };
+            
+            auto slot = hot(tag);
+            if (slot >= 0 && !hot_index[slot]) {
+                hot_index[slot] = static_cast<uint8_t>(count);
+            }
+        }
+        
+        String value(const Field & field) const {
+            return String(base + field.offset, field.length);
+        }
+        
+        // the first field with this tag, if any
+        const Field * find(int tag) const {
+            auto slot = hot(tag);
+            
+            if (slot >= 0) {
+                return hot_index[slot] ? &entries[hot_index[slot] - 1] : nullptr;
+            }
+            
+            for (size_t i = 0; i < count; ++i) {
+                if (entries[i].tag == tag) {
+                    return &entries[i];
+                }
+            }
+            
+            return nullptr;
+        }
+        
+        std::optional<String> get(int tag) const {
+            auto field = find(tag);
+            return field ? std::optional(value(*field)) : std::nullopt;
+        }
+        
+        bool has(int tag) const { return find(tag); }
+        
+        // all fields in message order
+        const Field * begin() const { return entries.data(); }
+        const Field * end() const { return entries.data() + count; }
+        size_t size() const { return count; }
+        bool overflow() const { return _overflow; }
+    };
+
     template <typename String>
     using VectorBasedStoragePolicy = SequenceBasedStoragePolicy<String, std::vector< std::pair<int, String> >>;
 
@@ -0,0 +1,185 @@
+//
+//  Scanner.hpp
+//  Market
+//
+//  Created by Blagovest on 12/12/20.
+//
+
+#ifndef Fix_Scanner_hpp
+#define Fix_Scanner_hpp
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "Tag.hpp"
+#include "../util/Cpu.hpp"
+
+namespace mkt {
+namespace fix {
+namespace scanner {
+
+    // delimiter bitmasks and byte sum of one 32 byte block
+    struct Block {
+        uint32_t equals;
+        uint32_t soh;
+        uint32_t sum;
+    };
+
+    constexpr size_t block_size = 32;
+
+    using util::Isa;
+    using util::isa;
+
+    struct ScalarKernel {
+        static Block block(const char * data) noexcept {
+            Block block { 0, 0, 0 };
+            
+            for (size_t i = 0; i < block_size; ++i) {
+                auto c = static_cast<unsigned char>(data[i]);
+                block.equals |= uint32_t(c == '=') << i;
+                block.soh |= uint32_t(c == 0x1) << i;
+                block.sum += c;
+            }
+            
+            return block;
+        }
+    };
+
+#ifdef MKT_X86
+    struct Sse2Kernel {
+        __attribute__((target("sse2")))
+        static Block block(const char * data) noexcept {
+            auto lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+            auto hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + 16));
+            auto equals = _mm_set1_epi8('=');
+            auto soh = _mm_set1_epi8(0x1);
+            // psadbw against zero sums each 8 byte half into a 64 bit lane
+            auto zero = _mm_setzero_si128();
+            auto sums = _mm_add_epi64(_mm_sad_epu8(lo, zero), _mm_sad_epu8(hi, zero));
+            
+            return Block {
+                uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(lo, equals))) | uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(hi, equals))) << 16,
+                uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(lo, soh))) | uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(hi, soh))) << 16,
+                uint32_t(_mm_cvtsi128_si32(sums)) + uint32_t(_mm_extract_epi16(sums, 4))
+            };
+        }
+    };
+
+    struct Avx2Kernel {
+        __attribute__((target("avx2")))
+        static Block block(const char * data) noexcept {
+            auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+            auto sums = _mm256_sad_epu8(bytes, _mm256_setzero_si256());
+            auto halves = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+            
+            return Block {
+                uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('=')))),
+                uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(0x1)))),
+                uint32_t(_mm_cvtsi128_si32(halves)) + uint32_t(_mm_extract_epi16(halves, 4))
+            };
+        }
+    };
+#endif
+
+    // Calls field(tag, start, value, end) with offsets into data for every
+    // tag=value<SOH> field, in order, and returns the checksum of all fields
+    // but CheckSum(10). As with the byte at a time parser, a value runs to
+    // the first SOH after the first '=' of its field; a trailing fragment
+    // without any '=' is ignored.
+    template <typename Kernel, typename Field>
+    __attribute__((always_inline)) inline unsigned char scan(const char * data, size_t size, Field && field) {
+        uint32_t total = 0;
+        uint32_t excluded = 0;
+        size_t start = 0, equals = 0;
+        bool in_value = false;
+        
+        auto emit = [&] (size_t end) {
+            int tag = 0;
+            for (auto i = start; i < equals; ++i) {
+                tag = 10 * tag + data[i] - '0';
+            }
+            
+            field(tag, start, equals + 1, end);
+            
+            if (tag == Tag::Checksum) {
+                for (auto i = start; i < end; ++i) {
+                    excluded += static_cast<unsigned char>(data[i]);
+                }
+                excluded += end < size ? 0x1 : 0;
+            } else if (end == size) {
+                total += 0x1; // counted as if the final SOH was there
+            }
+            
+            start = end + 1;
+        };
+        
+        auto consume = [&] (const Block & block, size_t base) {
+            total += block.sum;
+            auto bits = block.equals | block.soh;
+            
+            while (bits) {
+                auto i = static_cast<unsigned>(__builtin_ctz(bits));
+                bits &= bits - 1;
+                
+                if (!in_value) {
+                    if (block.equals >> i & 1) {
+                        equals = base + i;
+                        in_value = true;
+                    }
+                } else if (block.soh >> i & 1) {
+                    in_value = false;
+                    emit(base + i);
+                }
+            }
+        };
+        
+        size_t base = 0;
+        
+        for (; base + block_size <= size; base += block_size) {
+            consume(Kernel::block(data + base), base);
+        }
+        
+        if (base < size) {
+            // zero padding is neither a delimiter nor adds to the sum
+            char tail[block_size] = {};
+            std::memcpy(tail, data + base, size - base);
+            consume(Kernel::block(tail), base);
+        }
+        
+        if (in_value) {
+            emit(size);
+        }
+        
+        return static_cast<unsigned char>(total - excluded);
+    }
+
+#ifdef MKT_X86
+    // compiled for AVX2 as a whole, so the kernel inlines into the loop
+    template <typename Field>
+    __attribute__((target("avx2"))) unsigned char scan_avx2(const char * data, size_t size, Field && field) {
+        return scan<Avx2Kernel>(data, size, field);
+    }
+#endif
+
+    template <typename Field>
+    unsigned char scan(const char * data, size_t size, Field && field) {
+        switch (isa()) {
+#ifdef MKT_X86
+            case Isa::AVX2: return scan_avx2(data, size, field);
+            case Isa::SSE2: return scan<Sse2Kernel>(data, size, field);
+#endif
+            default: return scan<ScalarKernel>(data, size, field);
+        }
+    }
+
+    // whether scan() beats the byte at a time loop on this CPU
+    inline bool vectorized() noexcept {
+        return isa() != Isa::SCALAR;
+    }
+
+}
+}
+}
+
+#endif /* Scanner_hpp */
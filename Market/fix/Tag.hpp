@@ -8,8 +8,11 @@
 #ifndef Fix_Tags_Tag_h
 #define Fix_Tags_Tag_h
 
-#include <string>
-#include <utility>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
 
 namespace mkt {
 namespace fix {
@@ -20,22 +23,936 @@ namespace fix {
         };
         
         int id;
-        std::string name;
+        std::string_view name;
         Originator originator;
         
         int min_version;
         int max_version;
         int deprecated_since;
         
-        Tag(int id, std::string name, Originator originator, int min_version, int max_version, int deprecated_since): id(id), name(std::move(name)), originator(originator), min_version(min_version), max_version(max_version), deprecated_since(deprecated_since) {}
+        constexpr Tag(int id, std::string_view name, Originator originator, int min_version, int max_version, int deprecated_since): id(id), name(name), originator(originator), min_version(min_version), max_version(max_version), deprecated_since(deprecated_since) {}
         
-        operator int () const { return id; }
+        constexpr operator int () const { return id; }
         
         static const Tag & MsgType;
         static const Tag & Checksum;
         static const Tag & BeginString;
     };
 
+    // FIXME: Version info here is not complete, but can't be bothered right now
+    inline constexpr Tag TAGS[] = {
+        Tag(1, "Account", Tag::NA, 0, 0, 0),
+        Tag(2, "AdvId", Tag::NA, 0, 0, 0),
+        Tag(3, "AdvRefID", Tag::NA, 0, 0, 0),
+        Tag(4, "AdvSide", Tag::NA, 0, 0, 0),
+        Tag(5, "AdvTransType", Tag::NA, 0, 0, 0),
+        Tag(6, "AvgPx", Tag::NA, 0, 0, 0),
+        Tag(7, "BeginSeqNo", Tag::NA, 0, 0, 0),
+        Tag(8, "BeginString", Tag::NA, 0, 0, 0),
+        Tag(9, "BodyLength", Tag::NA, 0, 0, 0),
+        Tag(10, "CheckSum", Tag::NA, 0, 0, 0),
+        Tag(11, "ClOrdID", Tag::NA, 0, 0, 0),
+        Tag(12, "Commission", Tag::NA, 0, 0, 0),
+        Tag(13, "CommType", Tag::NA, 0, 0, 0),
+        Tag(14, "CumQty", Tag::NA, 0, 0, 0),
+        Tag(15, "Currency", Tag::NA, 0, 0, 0),
+        Tag(16, "EndSeqNo", Tag::NA, 0, 0, 0),
+        Tag(17, "ExecID", Tag::NA, 0, 0, 0),
+        Tag(18, "ExecInst", Tag::NA, 0, 0, 0),
+        Tag(19, "ExecRefID", Tag::NA, 0, 0, 0),
+        Tag(20, "ExecTransType", Tag::NA, 0, 0, 0),
+        Tag(21, "HandlInst", Tag::NA, 0, 0, 0),
+        Tag(22, "SecurityIDSource", Tag::NA, 0, 0, 0),
+        Tag(23, "IOIID", Tag::NA, 0, 0, 0),
+        Tag(24, "IOIOthSvc", Tag::NA, 0, 0, 0),
+        Tag(25, "IOIQltyInd", Tag::NA, 0, 0, 0),
+        Tag(26, "IOIRefID", Tag::NA, 0, 0, 0),
+        Tag(27, "IOIQty", Tag::NA, 0, 0, 0),
+        Tag(28, "IOITransType", Tag::NA, 0, 0, 0),
+        Tag(29, "LastCapacity", Tag::NA, 0, 0, 0),
+        Tag(30, "LastMkt", Tag::NA, 0, 0, 0),
+        Tag(31, "LastPx", Tag::NA, 0, 0, 0),
+        Tag(32, "LastQty", Tag::NA, 0, 0, 0),
+        Tag(33, "NoLinesOfText", Tag::NA, 0, 0, 0),
+        Tag(34, "MsgSeqNum", Tag::NA, 0, 0, 0),
+        Tag(35, "MsgType", Tag::NA, 0, 0, 0),
+        Tag(36, "NewSeqNo", Tag::NA, 0, 0, 0),
+        Tag(37, "OrderID", Tag::NA, 0, 0, 0),
+        Tag(38, "OrderQty", Tag::NA, 0, 0, 0),
+        Tag(39, "OrdStatus", Tag::NA, 0, 0, 0),
+        Tag(40, "OrdType", Tag::NA, 0, 0, 0),
+        Tag(41, "OrigClOrdID", Tag::NA, 0, 0, 0),
+        Tag(42, "OrigTime", Tag::NA, 0, 0, 0),
+        Tag(43, "PossDupFlag", Tag::NA, 0, 0, 0),
+        Tag(44, "Price", Tag::NA, 0, 0, 0),
+        Tag(45, "RefSeqNum", Tag::NA, 0, 0, 0),
+        Tag(46, "RelatdSym", Tag::NA, 0, 0, 0),
+        Tag(47, "Rule80A", Tag::NA, 0, 0, 0),
+        Tag(48, "SecurityID", Tag::NA, 0, 0, 0),
+        Tag(49, "SenderCompID", Tag::NA, 0, 0, 0),
+        Tag(50, "SenderSubID", Tag::NA, 0, 0, 0),
+        Tag(51, "SendingDate", Tag::NA, 0, 0, 0),
+        Tag(52, "SendingTime", Tag::NA, 0, 0, 0),
+        Tag(53, "Quantity", Tag::NA, 0, 0, 0),
+        Tag(54, "Side", Tag::NA, 0, 0, 0),
+        Tag(55, "Symbol", Tag::NA, 0, 0, 0),
+        Tag(56, "TargetCompID", Tag::NA, 0, 0, 0),
+        Tag(57, "TargetSubID", Tag::NA, 0, 0, 0),
+        Tag(58, "Text", Tag::NA, 0, 0, 0),
+        Tag(59, "TimeInForce", Tag::NA, 0, 0, 0),
+        Tag(60, "TransactTime", Tag::NA, 0, 0, 0),
+        Tag(61, "Urgency", Tag::NA, 0, 0, 0),
+        Tag(62, "ValidUntilTime", Tag::NA, 0, 0, 0),
+        Tag(63, "SettlType", Tag::NA, 0, 0, 0),
+        Tag(64, "SettlDate", Tag::NA, 0, 0, 0),
+        Tag(65, "SymbolSfx", Tag::NA, 0, 0, 0),
+        Tag(66, "ListID", Tag::NA, 0, 0, 0),
+        Tag(67, "ListSeqNo", Tag::NA, 0, 0, 0),
+        Tag(68, "TotNoOrders", Tag::NA, 0, 0, 0),
+        Tag(69, "ListExecInst", Tag::NA, 0, 0, 0),
+        Tag(70, "AllocID", Tag::NA, 0, 0, 0),
+        Tag(71, "AllocTransType", Tag::NA, 0, 0, 0),
+        Tag(72, "RefAllocID", Tag::NA, 0, 0, 0),
+        Tag(73, "NoOrders", Tag::NA, 0, 0, 0),
+        Tag(74, "AvgPxPrecision", Tag::NA, 0, 0, 0),
+        Tag(75, "TradeDate", Tag::NA, 0, 0, 0),
+        Tag(76, "ExecBroker", Tag::NA, 0, 0, 0),
+        Tag(77, "PositionEffect", Tag::NA, 0, 0, 0),
+        Tag(78, "NoAllocs", Tag::NA, 0, 0, 0),
+        Tag(79, "AllocAccount", Tag::NA, 0, 0, 0),
+        Tag(80, "AllocQty", Tag::NA, 0, 0, 0),
+        Tag(81, "ProcessCode", Tag::NA, 0, 0, 0),
+        Tag(82, "NoRpts", Tag::NA, 0, 0, 0),
+        Tag(83, "RptSeq", Tag::NA, 0, 0, 0),
+        Tag(84, "CxlQty", Tag::NA, 0, 0, 0),
+        Tag(85, "NoDlvyInst", Tag::NA, 0, 0, 0),
+        Tag(86, "DlvyInst", Tag::NA, 0, 0, 0),
+        Tag(87, "AllocStatus", Tag::NA, 0, 0, 0),
+        Tag(88, "AllocRejCode", Tag::NA, 0, 0, 0),
+        Tag(89, "Signature", Tag::NA, 0, 0, 0),
+        Tag(90, "SecureDataLen", Tag::NA, 0, 0, 0),
+        Tag(91, "SecureData", Tag::NA, 0, 0, 0),
+        Tag(92, "BrokerOfCredit", Tag::NA, 0, 0, 0),
+        Tag(93, "SignatureLength", Tag::NA, 0, 0, 0),
+        Tag(94, "EmailType", Tag::NA, 0, 0, 0),
+        Tag(95, "RawDataLength", Tag::NA, 0, 0, 0),
+        Tag(96, "RawData", Tag::NA, 0, 0, 0),
+        Tag(97, "PossResend", Tag::NA, 0, 0, 0),
+        Tag(98, "EncryptMethod", Tag::NA, 0, 0, 0),
+        Tag(99, "StopPx", Tag::NA, 0, 0, 0),
+        Tag(100, "ExDestination", Tag::NA, 0, 0, 0),
+        Tag(102, "CxlRejReason", Tag::NA, 0, 0, 0),
+        Tag(103, "OrdRejReason", Tag::NA, 0, 0, 0),
+        Tag(104, "IOIQualifier", Tag::NA, 0, 0, 0),
+        Tag(105, "WaveNo", Tag::NA, 0, 0, 0),
+        Tag(106, "Issuer", Tag::NA, 0, 0, 0),
+        Tag(107, "SecurityDesc", Tag::NA, 0, 0, 0),
+        Tag(108, "HeartBtInt", Tag::NA, 0, 0, 0),
+        Tag(109, "ClientID", Tag::NA, 0, 0, 0),
+        Tag(110, "MinQty", Tag::NA, 0, 0, 0),
+        Tag(111, "MaxFloor", Tag::NA, 0, 0, 0),
+        Tag(112, "TestReqID", Tag::NA, 0, 0, 0),
+        Tag(113, "ReportToExch", Tag::NA, 0, 0, 0),
+        Tag(114, "LocateReqd", Tag::NA, 0, 0, 0),
+        Tag(115, "OnBehalfOfCompID", Tag::NA, 0, 0, 0),
+        Tag(116, "OnBehalfOfSubID", Tag::NA, 0, 0, 0),
+        Tag(117, "QuoteID", Tag::NA, 0, 0, 0),
+        Tag(118, "NetMoney", Tag::NA, 0, 0, 0),
+        Tag(119, "SettlCurrAmt", Tag::NA, 0, 0, 0),
+        Tag(120, "SettlCurrency", Tag::NA, 0, 0, 0),
+        Tag(121, "ForexReq", Tag::NA, 0, 0, 0),
+        Tag(122, "OrigSendingTime", Tag::NA, 0, 0, 0),
+        Tag(123, "GapFillFlag", Tag::NA, 0, 0, 0),
+        Tag(124, "NoExecs", Tag::NA, 0, 0, 0),
+        Tag(125, "CxlType", Tag::NA, 0, 0, 0),
+        Tag(126, "ExpireTime", Tag::NA, 0, 0, 0),
+        Tag(127, "DKReason", Tag::NA, 0, 0, 0),
+        Tag(128, "DeliverToCompID", Tag::NA, 0, 0, 0),
+        Tag(129, "DeliverToSubID", Tag::NA, 0, 0, 0),
+        Tag(130, "IOINaturalFlag", Tag::NA, 0, 0, 0),
+        Tag(131, "QuoteReqID", Tag::NA, 0, 0, 0),
+        Tag(132, "BidPx", Tag::NA, 0, 0, 0),
+        Tag(133, "OfferPx", Tag::NA, 0, 0, 0),
+        Tag(134, "BidSize", Tag::NA, 0, 0, 0),
+        Tag(135, "OfferSize", Tag::NA, 0, 0, 0),
+        Tag(136, "NoMiscFees", Tag::NA, 0, 0, 0),
+        Tag(137, "MiscFeeAmt", Tag::NA, 0, 0, 0),
+        Tag(138, "MiscFeeCurr", Tag::NA, 0, 0, 0),
+        Tag(139, "MiscFeeType", Tag::NA, 0, 0, 0),
+        Tag(140, "PrevClosePx", Tag::NA, 0, 0, 0),
+        Tag(141, "ResetSeqNumFlag", Tag::NA, 0, 0, 0),
+        Tag(142, "SenderLocationID", Tag::NA, 0, 0, 0),
+        Tag(143, "TargetLocationID", Tag::NA, 0, 0, 0),
+        Tag(144, "OnBehalfOfLocationID", Tag::NA, 0, 0, 0),
+        Tag(145, "DeliverToLocationID", Tag::NA, 0, 0, 0),
+        Tag(146, "NoRelatedSym", Tag::NA, 0, 0, 0),
+        Tag(147, "Subject", Tag::NA, 0, 0, 0),
+        Tag(148, "Headline", Tag::NA, 0, 0, 0),
+        Tag(149, "URLLink", Tag::NA, 0, 0, 0),
+        Tag(150, "ExecType", Tag::NA, 0, 0, 0),
+        Tag(151, "LeavesQty", Tag::NA, 0, 0, 0),
+        Tag(152, "CashOrderQty", Tag::NA, 0, 0, 0),
+        Tag(153, "AllocAvgPx", Tag::NA, 0, 0, 0),
+        Tag(154, "AllocNetMoney", Tag::NA, 0, 0, 0),
+        Tag(155, "SettlCurrFxRate", Tag::NA, 0, 0, 0),
+        Tag(156, "SettlCurrFxRateCalc", Tag::NA, 0, 0, 0),
+        Tag(157, "NumDaysInterest", Tag::NA, 0, 0, 0),
+        Tag(158, "AccruedInterestRate", Tag::NA, 0, 0, 0),
+        Tag(159, "AccruedInterestAmt", Tag::NA, 0, 0, 0),
+        Tag(160, "SettlInstMode", Tag::NA, 0, 0, 0),
+        Tag(161, "AllocText", Tag::NA, 0, 0, 0),
+        Tag(162, "SettlInstID", Tag::NA, 0, 0, 0),
+        Tag(163, "SettlInstTransType", Tag::NA, 0, 0, 0),
+        Tag(164, "EmailThreadID", Tag::NA, 0, 0, 0),
+        Tag(165, "SettlInstSource", Tag::NA, 0, 0, 0),
+        Tag(166, "SettlLocation", Tag::NA, 0, 0, 0),
+        Tag(167, "SecurityType", Tag::NA, 0, 0, 0),
+        Tag(168, "EffectiveTime", Tag::NA, 0, 0, 0),
+        Tag(169, "StandInstDbType", Tag::NA, 0, 0, 0),
+        Tag(170, "StandInstDbName", Tag::NA, 0, 0, 0),
+        Tag(171, "StandInstDbID", Tag::NA, 0, 0, 0),
+        Tag(172, "SettlDeliveryType", Tag::NA, 0, 0, 0),
+        Tag(173, "SettlDepositoryCode", Tag::NA, 0, 0, 0),
+        Tag(174, "SettlBrkrCode", Tag::NA, 0, 0, 0),
+        Tag(175, "SettlInstCode", Tag::NA, 0, 0, 0),
+        Tag(176, "SecuritySettlAgentName", Tag::NA, 0, 0, 0),
+        Tag(177, "SecuritySettlAgentCode", Tag::NA, 0, 0, 0),
+        Tag(178, "SecuritySettlAgentAcctNum", Tag::NA, 0, 0, 0),
+        Tag(179, "SecuritySettlAgentAcctName", Tag::NA, 0, 0, 0),
+        Tag(180, "SecuritySettlAgentContactName", Tag::NA, 0, 0, 0),
+        Tag(181, "SecuritySettlAgentContactPhone", Tag::NA, 0, 0, 0),
+        Tag(182, "CashSettlAgentName", Tag::NA, 0, 0, 0),
+        Tag(183, "CashSettlAgentCode", Tag::NA, 0, 0, 0),
+        Tag(184, "CashSettlAgentAcctNum", Tag::NA, 0, 0, 0),
+        Tag(185, "CashSettlAgentAcctName", Tag::NA, 0, 0, 0),
+        Tag(186, "CashSettlAgentContactName", Tag::NA, 0, 0, 0),
+        Tag(187, "CashSettlAgentContactPhone", Tag::NA, 0, 0, 0),
+        Tag(188, "BidSpotRate", Tag::NA, 0, 0, 0),
+        Tag(189, "BidForwardPoints", Tag::NA, 0, 0, 0),
+        Tag(190, "OfferSpotRate", Tag::NA, 0, 0, 0),
+        Tag(191, "OfferForwardPoints", Tag::NA, 0, 0, 0),
+        Tag(192, "OrderQty2", Tag::NA, 0, 0, 0),
+        Tag(193, "SettlDate2", Tag::NA, 0, 0, 0),
+        Tag(194, "LastSpotRate", Tag::NA, 0, 0, 0),
+        Tag(195, "LastForwardPoints", Tag::NA, 0, 0, 0),
+        Tag(196, "AllocLinkID", Tag::NA, 0, 0, 0),
+        Tag(197, "AllocLinkType", Tag::NA, 0, 0, 0),
+        Tag(198, "SecondaryOrderID", Tag::NA, 0, 0, 0),
+        Tag(199, "NoIOIQualifiers", Tag::NA, 0, 0, 0),
+        Tag(200, "MaturityMonthYear", Tag::NA, 0, 0, 0),
+        Tag(201, "PutOrCall", Tag::NA, 0, 0, 0),
+        Tag(202, "StrikePrice", Tag::NA, 0, 0, 0),
+        Tag(203, "CoveredOrUncovered", Tag::NA, 0, 0, 0),
+        Tag(204, "CustomerOrFirm", Tag::NA, 0, 0, 0),
+        Tag(205, "MaturityDay", Tag::NA, 0, 0, 0),
+        Tag(206, "OptAttribute", Tag::NA, 0, 0, 0),
+        Tag(207, "SecurityExchange", Tag::NA, 0, 0, 0),
+        Tag(208, "NotifyBrokerOfCredit", Tag::NA, 0, 0, 0),
+        Tag(209, "AllocHandlInst", Tag::NA, 0, 0, 0),
+        Tag(210, "MaxShow", Tag::NA, 0, 0, 0),
+        Tag(211, "PegOffsetValue", Tag::NA, 0, 0, 0),
+        Tag(212, "XmlDataLen", Tag::NA, 0, 0, 0),
+        Tag(213, "XmlData", Tag::NA, 0, 0, 0),
+        Tag(214, "SettlInstRefID", Tag::NA, 0, 0, 0),
+        Tag(215, "NoRoutingIDs", Tag::NA, 0, 0, 0),
+        Tag(216, "RoutingType", Tag::NA, 0, 0, 0),
+        Tag(217, "RoutingID", Tag::NA, 0, 0, 0),
+        Tag(218, "Spread", Tag::NA, 0, 0, 0),
+        Tag(219, "Benchmark", Tag::NA, 0, 0, 0),
+        Tag(220, "BenchmarkCurveCurrency", Tag::NA, 0, 0, 0),
+        Tag(221, "BenchmarkCurveName", Tag::NA, 0, 0, 0),
+        Tag(222, "BenchmarkCurvePoint", Tag::NA, 0, 0, 0),
+        Tag(223, "CouponRate", Tag::NA, 0, 0, 0),
+        Tag(224, "CouponPaymentDate", Tag::NA, 0, 0, 0),
+        Tag(225, "IssueDate", Tag::NA, 0, 0, 0),
+        Tag(226, "RepurchaseTerm", Tag::NA, 0, 0, 0),
+        Tag(227, "RepurchaseRate", Tag::NA, 0, 0, 0),
+        Tag(228, "Factor", Tag::NA, 0, 0, 0),
+        Tag(229, "TradeOriginationDate", Tag::NA, 0, 0, 0),
+        Tag(230, "ExDate", Tag::NA, 0, 0, 0),
+        Tag(231, "ContractMultiplier", Tag::NA, 0, 0, 0),
+        Tag(232, "NoStipulations", Tag::NA, 0, 0, 0),
+        Tag(233, "StipulationType", Tag::NA, 0, 0, 0),
+        Tag(234, "StipulationValue", Tag::NA, 0, 0, 0),
+        Tag(235, "YieldType", Tag::NA, 0, 0, 0),
+        Tag(236, "Yield", Tag::NA, 0, 0, 0),
+        Tag(237, "TotalTakedown", Tag::NA, 0, 0, 0),
+        Tag(238, "Concession", Tag::NA, 0, 0, 0),
+        Tag(239, "RepoCollateralSecurityType", Tag::NA, 0, 0, 0),
+        Tag(240, "RedemptionDate", Tag::NA, 0, 0, 0),
+        Tag(241, "UnderlyingCouponPaymentDate", Tag::NA, 0, 0, 0),
+        Tag(242, "UnderlyingIssueDate", Tag::NA, 0, 0, 0),
+        Tag(243, "UnderlyingRepoCollateralSecurityType", Tag::NA, 0, 0, 0),
+        Tag(244, "UnderlyingRepurchaseTerm", Tag::NA, 0, 0, 0),
+        Tag(245, "UnderlyingRepurchaseRate", Tag::NA, 0, 0, 0),
+        Tag(246, "UnderlyingFactor", Tag::NA, 0, 0, 0),
+        Tag(247, "UnderlyingRedemptionDate", Tag::NA, 0, 0, 0),
+        Tag(248, "LegCouponPaymentDate", Tag::NA, 0, 0, 0),
+        Tag(249, "LegIssueDate", Tag::NA, 0, 0, 0),
+        Tag(250, "LegRepoCollateralSecurityType", Tag::NA, 0, 0, 0),
+        Tag(251, "LegRepurchaseTerm", Tag::NA, 0, 0, 0),
+        Tag(252, "LegRepurchaseRate", Tag::NA, 0, 0, 0),
+        Tag(253, "LegFactor", Tag::NA, 0, 0, 0),
+        Tag(254, "LegRedemptionDate", Tag::NA, 0, 0, 0),
+        Tag(255, "CreditRating", Tag::NA, 0, 0, 0),
+        Tag(256, "UnderlyingCreditRating", Tag::NA, 0, 0, 0),
+        Tag(257, "LegCreditRating", Tag::NA, 0, 0, 0),
+        Tag(258, "TradedFlatSwitch", Tag::NA, 0, 0, 0),
+        Tag(259, "BasisFeatureDate", Tag::NA, 0, 0, 0),
+        Tag(260, "BasisFeaturePrice", Tag::NA, 0, 0, 0),
+        Tag(262, "MDReqID", Tag::NA, 0, 0, 0),
+        Tag(263, "SubscriptionRequestType", Tag::NA, 0, 0, 0),
+        Tag(264, "MarketDepth", Tag::NA, 0, 0, 0),
+        Tag(265, "MDUpdateType", Tag::NA, 0, 0, 0),
+        Tag(266, "AggregatedBook", Tag::NA, 0, 0, 0),
+        Tag(267, "NoMDEntryTypes", Tag::NA, 0, 0, 0),
+        Tag(268, "NoMDEntries", Tag::NA, 0, 0, 0),
+        Tag(269, "MDEntryType", Tag::NA, 0, 0, 0),
+        Tag(270, "MDEntryPx", Tag::NA, 0, 0, 0),
+        Tag(271, "MDEntrySize", Tag::NA, 0, 0, 0),
+        Tag(272, "MDEntryDate", Tag::NA, 0, 0, 0),
+        Tag(273, "MDEntryTime", Tag::NA, 0, 0, 0),
+        Tag(274, "TickDirection", Tag::NA, 0, 0, 0),
+        Tag(275, "MDMkt", Tag::NA, 0, 0, 0),
+        Tag(276, "QuoteCondition", Tag::NA, 0, 0, 0),
+        Tag(277, "TradeCondition", Tag::NA, 0, 0, 0),
+        Tag(278, "MDEntryID", Tag::NA, 0, 0, 0),
+        Tag(279, "MDUpdateAction", Tag::NA, 0, 0, 0),
+        Tag(280, "MDEntryRefID", Tag::NA, 0, 0, 0),
+        Tag(281, "MDReqRejReason", Tag::NA, 0, 0, 0),
+        Tag(282, "MDEntryOriginator", Tag::NA, 0, 0, 0),
+        Tag(283, "LocationID", Tag::NA, 0, 0, 0),
+        Tag(284, "DeskID", Tag::NA, 0, 0, 0),
+        Tag(285, "DeleteReason", Tag::NA, 0, 0, 0),
+        Tag(286, "OpenCloseSettlFlag", Tag::NA, 0, 0, 0),
+        Tag(287, "SellerDays", Tag::NA, 0, 0, 0),
+        Tag(288, "MDEntryBuyer", Tag::NA, 0, 0, 0),
+        Tag(289, "MDEntrySeller", Tag::NA, 0, 0, 0),
+        Tag(290, "MDEntryPositionNo", Tag::NA, 0, 0, 0),
+        Tag(291, "FinancialStatus", Tag::NA, 0, 0, 0),
+        Tag(292, "CorporateAction", Tag::NA, 0, 0, 0),
+        Tag(293, "DefBidSize", Tag::NA, 0, 0, 0),
+        Tag(294, "DefOfferSize", Tag::NA, 0, 0, 0),
+        Tag(295, "NoQuoteEntries", Tag::NA, 0, 0, 0),
+        Tag(296, "NoQuoteSets", Tag::NA, 0, 0, 0),
+        Tag(297, "QuoteStatus", Tag::NA, 0, 0, 0),
+        Tag(298, "QuoteCancelType", Tag::NA, 0, 0, 0),
+        Tag(299, "QuoteEntryID", Tag::NA, 0, 0, 0),
+        Tag(300, "QuoteRejectReason", Tag::NA, 0, 0, 0),
+        Tag(301, "QuoteResponseLevel", Tag::NA, 0, 0, 0),
+        Tag(302, "QuoteSetID", Tag::NA, 0, 0, 0),
+        Tag(303, "QuoteRequestType", Tag::NA, 0, 0, 0),
+        Tag(304, "TotNoQuoteEntries", Tag::NA, 0, 0, 0),
+        Tag(305, "UnderlyingSecurityIDSource", Tag::NA, 0, 0, 0),
+        Tag(306, "UnderlyingIssuer", Tag::NA, 0, 0, 0),
+        Tag(307, "UnderlyingSecurityDesc", Tag::NA, 0, 0, 0),
+        Tag(308, "UnderlyingSecurityExchange", Tag::NA, 0, 0, 0),
+        Tag(309, "UnderlyingSecurityID", Tag::NA, 0, 0, 0),
+        Tag(310, "UnderlyingSecurityType", Tag::NA, 0, 0, 0),
+        Tag(311, "UnderlyingSymbol", Tag::NA, 0, 0, 0),
+        Tag(312, "UnderlyingSymbolSfx", Tag::NA, 0, 0, 0),
+        Tag(313, "UnderlyingMaturityMonthYear", Tag::NA, 0, 0, 0),
+        Tag(314, "UnderlyingMaturityDay", Tag::NA, 0, 0, 0),
+        Tag(315, "UnderlyingPutOrCall", Tag::NA, 0, 0, 0),
+        Tag(316, "UnderlyingStrikePrice", Tag::NA, 0, 0, 0),
+        Tag(317, "UnderlyingOptAttribute", Tag::NA, 0, 0, 0),
+        Tag(318, "UnderlyingCurrency", Tag::NA, 0, 0, 0),
+        Tag(319, "RatioQty", Tag::NA, 0, 0, 0),
+        Tag(320, "SecurityReqID", Tag::NA, 0, 0, 0),
+        Tag(321, "SecurityRequestType", Tag::NA, 0, 0, 0),
+        Tag(322, "SecurityResponseID", Tag::NA, 0, 0, 0),
+        Tag(323, "SecurityResponseType", Tag::NA, 0, 0, 0),
+        Tag(324, "SecurityStatusReqID", Tag::NA, 0, 0, 0),
+        Tag(325, "UnsolicitedIndicator", Tag::NA, 0, 0, 0),
+        Tag(326, "SecurityTradingStatus", Tag::NA, 0, 0, 0),
+        Tag(327, "HaltReason", Tag::NA, 0, 0, 0),
+        Tag(328, "InViewOfCommon", Tag::NA, 0, 0, 0),
+        Tag(329, "DueToRelated", Tag::NA, 0, 0, 0),
+        Tag(330, "BuyVolume", Tag::NA, 0, 0, 0),
+        Tag(331, "SellVolume", Tag::NA, 0, 0, 0),
+        Tag(332, "HighPx", Tag::NA, 0, 0, 0),
+        Tag(333, "LowPx", Tag::NA, 0, 0, 0),
+        Tag(334, "Adjustment", Tag::NA, 0, 0, 0),
+        Tag(335, "TradSesReqID", Tag::NA, 0, 0, 0),
+        Tag(336, "TradingSessionID", Tag::NA, 0, 0, 0),
+        Tag(337, "ContraTrader", Tag::NA, 0, 0, 0),
+        Tag(338, "TradSesMethod", Tag::NA, 0, 0, 0),
+        Tag(339, "TradSesMode", Tag::NA, 0, 0, 0),
+        Tag(340, "TradSesStatus", Tag::NA, 0, 0, 0),
+        Tag(341, "TradSesStartTime", Tag::NA, 0, 0, 0),
+        Tag(342, "TradSesOpenTime", Tag::NA, 0, 0, 0),
+        Tag(343, "TradSesPreCloseTime", Tag::NA, 0, 0, 0),
+        Tag(344, "TradSesCloseTime", Tag::NA, 0, 0, 0),
+        Tag(345, "TradSesEndTime", Tag::NA, 0, 0, 0),
+        Tag(346, "NumberOfOrders", Tag::NA, 0, 0, 0),
+        Tag(347, "MessageEncoding", Tag::NA, 0, 0, 0),
+        Tag(348, "EncodedIssuerLen", Tag::NA, 0, 0, 0),
+        Tag(349, "EncodedIssuer", Tag::NA, 0, 0, 0),
+        Tag(350, "EncodedSecurityDescLen", Tag::NA, 0, 0, 0),
+        Tag(351, "EncodedSecurityDesc", Tag::NA, 0, 0, 0),
+        Tag(352, "EncodedListExecInstLen", Tag::NA, 0, 0, 0),
+        Tag(353, "EncodedListExecInst", Tag::NA, 0, 0, 0),
+        Tag(354, "EncodedTextLen", Tag::NA, 0, 0, 0),
+        Tag(355, "EncodedText", Tag::NA, 0, 0, 0),
+        Tag(356, "EncodedSubjectLen", Tag::NA, 0, 0, 0),
+        Tag(357, "EncodedSubject", Tag::NA, 0, 0, 0),
+        Tag(358, "EncodedHeadlineLen", Tag::NA, 0, 0, 0),
+        Tag(359, "EncodedHeadline", Tag::NA, 0, 0, 0),
+        Tag(360, "EncodedAllocTextLen", Tag::NA, 0, 0, 0),
+        Tag(361, "EncodedAllocText", Tag::NA, 0, 0, 0),
+        Tag(362, "EncodedUnderlyingIssuerLen", Tag::NA, 0, 0, 0),
+        Tag(363, "EncodedUnderlyingIssuer", Tag::NA, 0, 0, 0),
+        Tag(364, "EncodedUnderlyingSecurityDescLen", Tag::NA, 0, 0, 0),
+        Tag(365, "EncodedUnderlyingSecurityDesc", Tag::NA, 0, 0, 0),
+        Tag(366, "AllocPrice", Tag::NA, 0, 0, 0),
+        Tag(367, "QuoteSetValidUntilTime", Tag::NA, 0, 0, 0),
+        Tag(368, "QuoteEntryRejectReason", Tag::NA, 0, 0, 0),
+        Tag(369, "LastMsgSeqNumProcessed", Tag::NA, 0, 0, 0),
+        Tag(370, "OnBehalfOfSendingTime", Tag::NA, 0, 0, 0),
+        Tag(371, "RefTagID", Tag::NA, 0, 0, 0),
+        Tag(372, "RefMsgType", Tag::NA, 0, 0, 0),
+        Tag(373, "SessionRejectReason", Tag::NA, 0, 0, 0),
+        Tag(374, "BidRequestTransType", Tag::NA, 0, 0, 0),
+        Tag(375, "ContraBroker", Tag::NA, 0, 0, 0),
+        Tag(376, "ComplianceID", Tag::NA, 0, 0, 0),
+        Tag(377, "SolicitedFlag", Tag::NA, 0, 0, 0),
+        Tag(378, "ExecRestatementReason", Tag::NA, 0, 0, 0),
+        Tag(379, "BusinessRejectRefID", Tag::NA, 0, 0, 0),
+        Tag(380, "BusinessRejectReason", Tag::NA, 0, 0, 0),
+        Tag(381, "GrossTradeAmt", Tag::NA, 0, 0, 0),
+        Tag(382, "NoContraBrokers", Tag::NA, 0, 0, 0),
+        Tag(383, "MaxMessageSize", Tag::NA, 0, 0, 0),
+        Tag(384, "NoMsgTypes", Tag::NA, 0, 0, 0),
+        Tag(385, "MsgDirection", Tag::NA, 0, 0, 0),
+        Tag(386, "NoTradingSessions", Tag::NA, 0, 0, 0),
+        Tag(387, "TotalVolumeTraded", Tag::NA, 0, 0, 0),
+        Tag(388, "DiscretionInst", Tag::NA, 0, 0, 0),
+        Tag(389, "DiscretionOffsetValue", Tag::NA, 0, 0, 0),
+        Tag(390, "BidID", Tag::NA, 0, 0, 0),
+        Tag(391, "ClientBidID", Tag::NA, 0, 0, 0),
+        Tag(392, "ListName", Tag::NA, 0, 0, 0),
+        Tag(393, "TotNoRelatedSym", Tag::NA, 0, 0, 0),
+        Tag(394, "BidType", Tag::NA, 0, 0, 0),
+        Tag(395, "NumTickets", Tag::NA, 0, 0, 0),
+        Tag(396, "SideValue1", Tag::NA, 0, 0, 0),
+        Tag(397, "SideValue2", Tag::NA, 0, 0, 0),
+        Tag(398, "NoBidDescriptors", Tag::NA, 0, 0, 0),
+        Tag(399, "BidDescriptorType", Tag::NA, 0, 0, 0),
+        Tag(400, "BidDescriptor", Tag::NA, 0, 0, 0),
+        Tag(401, "SideValueInd", Tag::NA, 0, 0, 0),
+        Tag(402, "LiquidityPctLow", Tag::NA, 0, 0, 0),
+        Tag(403, "LiquidityPctHigh", Tag::NA, 0, 0, 0),
+        Tag(404, "LiquidityValue", Tag::NA, 0, 0, 0),
+        Tag(405, "EFPTrackingError", Tag::NA, 0, 0, 0),
+        Tag(406, "FairValue", Tag::NA, 0, 0, 0),
+        Tag(407, "OutsideIndexPct", Tag::NA, 0, 0, 0),
+        Tag(408, "ValueOfFutures", Tag::NA, 0, 0, 0),
+        Tag(409, "LiquidityIndType", Tag::NA, 0, 0, 0),
+        Tag(410, "WtAverageLiquidity", Tag::NA, 0, 0, 0),
+        Tag(411, "ExchangeForPhysical", Tag::NA, 0, 0, 0),
+        Tag(412, "OutMainCntryUIndex", Tag::NA, 0, 0, 0),
+        Tag(413, "CrossPercent", Tag::NA, 0, 0, 0),
+        Tag(414, "ProgRptReqs", Tag::NA, 0, 0, 0),
+        Tag(415, "ProgPeriodInterval", Tag::NA, 0, 0, 0),
+        Tag(416, "IncTaxInd", Tag::NA, 0, 0, 0),
+        Tag(417, "NumBidders", Tag::NA, 0, 0, 0),
+        Tag(418, "BidTradeType", Tag::NA, 0, 0, 0),
+        Tag(419, "BasisPxType", Tag::NA, 0, 0, 0),
+        Tag(420, "NoBidComponents", Tag::NA, 0, 0, 0),
+        Tag(421, "Country", Tag::NA, 0, 0, 0),
+        Tag(422, "TotNoStrikes", Tag::NA, 0, 0, 0),
+        Tag(423, "PriceType", Tag::NA, 0, 0, 0),
+        Tag(424, "DayOrderQty", Tag::NA, 0, 0, 0),
+        Tag(425, "DayCumQty", Tag::NA, 0, 0, 0),
+        Tag(426, "DayAvgPx", Tag::NA, 0, 0, 0),
+        Tag(427, "GTBookingInst", Tag::NA, 0, 0, 0),
+        Tag(428, "NoStrikes", Tag::NA, 0, 0, 0),
+        Tag(429, "ListStatusType", Tag::NA, 0, 0, 0),
+        Tag(430, "NetGrossInd", Tag::NA, 0, 0, 0),
+        Tag(431, "ListOrderStatus", Tag::NA, 0, 0, 0),
+        Tag(432, "ExpireDate", Tag::NA, 0, 0, 0),
+        Tag(433, "ListExecInstType", Tag::NA, 0, 0, 0),
+        Tag(434, "CxlRejResponseTo", Tag::NA, 0, 0, 0),
+        Tag(435, "UnderlyingCouponRate", Tag::NA, 0, 0, 0),
+        Tag(436, "UnderlyingContractMultiplier", Tag::NA, 0, 0, 0),
+        Tag(437, "ContraTradeQty", Tag::NA, 0, 0, 0),
+        Tag(438, "ContraTradeTime", Tag::NA, 0, 0, 0),
+        Tag(439, "ClearingFirm", Tag::NA, 0, 0, 0),
+        Tag(440, "ClearingAccount", Tag::NA, 0, 0, 0),
+        Tag(441, "LiquidityNumSecurities", Tag::NA, 0, 0, 0),
+        Tag(442, "MultiLegReportingType", Tag::NA, 0, 0, 0),
+        Tag(443, "StrikeTime", Tag::NA, 0, 0, 0),
+        Tag(444, "ListStatusText", Tag::NA, 0, 0, 0),
+        Tag(445, "EncodedListStatusTextLen", Tag::NA, 0, 0, 0),
+        Tag(446, "EncodedListStatusText", Tag::NA, 0, 0, 0),
+        Tag(447, "PartyIDSource", Tag::NA, 0, 0, 0),
+        Tag(448, "PartyID", Tag::NA, 0, 0, 0),
+        Tag(449, "TotalVolumeTradedDate", Tag::NA, 0, 0, 0),
+        Tag(450, "TotalVolumeTradedTime", Tag::NA, 0, 0, 0),
+        Tag(451, "NetChgPrevDay", Tag::NA, 0, 0, 0),
+        Tag(452, "PartyRole", Tag::NA, 0, 0, 0),
+        Tag(453, "NoPartyIDs", Tag::NA, 0, 0, 0),
+        Tag(454, "NoSecurityAltID", Tag::NA, 0, 0, 0),
+        Tag(455, "SecurityAltID", Tag::NA, 0, 0, 0),
+        Tag(456, "SecurityAltIDSource", Tag::NA, 0, 0, 0),
+        Tag(457, "NoUnderlyingSecurityAltID", Tag::NA, 0, 0, 0),
+        Tag(458, "UnderlyingSecurityAltID", Tag::NA, 0, 0, 0),
+        Tag(459, "UnderlyingSecurityAltIDSource", Tag::NA, 0, 0, 0),
+        Tag(460, "Product", Tag::NA, 0, 0, 0),
+        Tag(461, "CFICode", Tag::NA, 0, 0, 0),
+        Tag(462, "UnderlyingProduct", Tag::NA, 0, 0, 0),
+        Tag(463, "UnderlyingCFICode", Tag::NA, 0, 0, 0),
+        Tag(464, "TestMessageIndicator", Tag::NA, 0, 0, 0),
+        Tag(465, "QuantityType", Tag::NA, 0, 0, 0),
+        Tag(466, "BookingRefID", Tag::NA, 0, 0, 0),
+        Tag(467, "IndividualAllocID", Tag::NA, 0, 0, 0),
+        Tag(468, "RoundingDirection", Tag::NA, 0, 0, 0),
+        Tag(469, "RoundingModulus", Tag::NA, 0, 0, 0),
+        Tag(470, "CountryOfIssue", Tag::NA, 0, 0, 0),
+        Tag(471, "StateOrProvinceOfIssue", Tag::NA, 0, 0, 0),
+        Tag(472, "LocaleOfIssue", Tag::NA, 0, 0, 0),
+        Tag(473, "NoRegistDtls", Tag::NA, 0, 0, 0),
+        Tag(474, "MailingDtls", Tag::NA, 0, 0, 0),
+        Tag(475, "InvestorCountryOfResidence", Tag::NA, 0, 0, 0),
+        Tag(476, "PaymentRef", Tag::NA, 0, 0, 0),
+        Tag(477, "DistribPaymentMethod", Tag::NA, 0, 0, 0),
+        Tag(478, "CashDistribCurr", Tag::NA, 0, 0, 0),
+        Tag(479, "CommCurrency", Tag::NA, 0, 0, 0),
+        Tag(480, "CancellationRights", Tag::NA, 0, 0, 0),
+        Tag(481, "MoneyLaunderingStatus", Tag::NA, 0, 0, 0),
+        Tag(482, "MailingInst", Tag::NA, 0, 0, 0),
+        Tag(483, "TransBkdTime", Tag::NA, 0, 0, 0),
+        Tag(484, "ExecPriceType", Tag::NA, 0, 0, 0),
+        Tag(485, "ExecPriceAdjustment", Tag::NA, 0, 0, 0),
+        Tag(486, "DateOfBirth", Tag::NA, 0, 0, 0),
+        Tag(487, "TradeReportTransType", Tag::NA, 0, 0, 0),
+        Tag(488, "CardHolderName", Tag::NA, 0, 0, 0),
+        Tag(489, "CardNumber", Tag::NA, 0, 0, 0),
+        Tag(490, "CardExpDate", Tag::NA, 0, 0, 0),
+        Tag(491, "CardIssNum", Tag::NA, 0, 0, 0),
+        Tag(492, "PaymentMethod", Tag::NA, 0, 0, 0),
+        Tag(493, "RegistAcctType", Tag::NA, 0, 0, 0),
+        Tag(494, "Designation", Tag::NA, 0, 0, 0),
+        Tag(495, "TaxAdvantageType", Tag::NA, 0, 0, 0),
+        Tag(496, "RegistRejReasonText", Tag::NA, 0, 0, 0),
+        Tag(497, "FundRenewWaiv", Tag::NA, 0, 0, 0),
+        Tag(498, "CashDistribAgentName", Tag::NA, 0, 0, 0),
+        Tag(499, "CashDistribAgentCode", Tag::NA, 0, 0, 0),
+        Tag(500, "CashDistribAgentAcctNumber", Tag::NA, 0, 0, 0),
+        Tag(501, "CashDistribPayRef", Tag::NA, 0, 0, 0),
+        Tag(502, "CashDistribAgentAcctName", Tag::NA, 0, 0, 0),
+        Tag(503, "CardStartDate", Tag::NA, 0, 0, 0),
+        Tag(504, "PaymentDate", Tag::NA, 0, 0, 0),
+        Tag(505, "PaymentRemitterID", Tag::NA, 0, 0, 0),
+        Tag(506, "RegistStatus", Tag::NA, 0, 0, 0),
+        Tag(507, "RegistRejReasonCode", Tag::NA, 0, 0, 0),
+        Tag(508, "RegistRefID", Tag::NA, 0, 0, 0),
+        Tag(509, "RegistDtls", Tag::NA, 0, 0, 0),
+        Tag(510, "NoDistribInsts", Tag::NA, 0, 0, 0),
+        Tag(511, "RegistEmail", Tag::NA, 0, 0, 0),
+        Tag(512, "DistribPercentage", Tag::NA, 0, 0, 0),
+        Tag(513, "RegistID", Tag::NA, 0, 0, 0),
+        Tag(514, "RegistTransType", Tag::NA, 0, 0, 0),
+        Tag(515, "ExecValuationPoint", Tag::NA, 0, 0, 0),
+        Tag(516, "OrderPercent", Tag::NA, 0, 0, 0),
+        Tag(517, "OwnershipType", Tag::NA, 0, 0, 0),
+        Tag(518, "NoContAmts", Tag::NA, 0, 0, 0),
+        Tag(519, "ContAmtType", Tag::NA, 0, 0, 0),
+        Tag(520, "ContAmtValue", Tag::NA, 0, 0, 0),
+        Tag(521, "ContAmtCurr", Tag::NA, 0, 0, 0),
+        Tag(522, "OwnerType", Tag::NA, 0, 0, 0),
+        Tag(523, "PartySubID", Tag::NA, 0, 0, 0),
+        Tag(524, "NestedPartyID", Tag::NA, 0, 0, 0),
+        Tag(525, "NestedPartyIDSource", Tag::NA, 0, 0, 0),
+        Tag(526, "SecondaryClOrdID", Tag::NA, 0, 0, 0),
+        Tag(527, "SecondaryExecID", Tag::NA, 0, 0, 0),
+        Tag(528, "OrderCapacity", Tag::NA, 0, 0, 0),
+        Tag(529, "OrderRestrictions", Tag::NA, 0, 0, 0),
+        Tag(530, "MassCancelRequestType", Tag::NA, 0, 0, 0),
+        Tag(531, "MassCancelResponse", Tag::NA, 0, 0, 0),
+        Tag(532, "MassCancelRejectReason", Tag::NA, 0, 0, 0),
+        Tag(533, "TotalAffectedOrders", Tag::NA, 0, 0, 0),
+        Tag(534, "NoAffectedOrders", Tag::NA, 0, 0, 0),
+        Tag(535, "AffectedOrderID", Tag::NA, 0, 0, 0),
+        Tag(536, "AffectedSecondaryOrderID", Tag::NA, 0, 0, 0),
+        Tag(537, "QuoteType", Tag::NA, 0, 0, 0),
+        Tag(538, "NestedPartyRole", Tag::NA, 0, 0, 0),
+        Tag(539, "NoNestedPartyIDs", Tag::NA, 0, 0, 0),
+        Tag(540, "TotalAccruedInterestAmt", Tag::NA, 0, 0, 0),
+        Tag(541, "MaturityDate", Tag::NA, 0, 0, 0),
+        Tag(542, "UnderlyingMaturityDate", Tag::NA, 0, 0, 0),
+        Tag(543, "InstrRegistry", Tag::NA, 0, 0, 0),
+        Tag(544, "CashMargin", Tag::NA, 0, 0, 0),
+        Tag(545, "NestedPartySubID", Tag::NA, 0, 0, 0),
+        Tag(546, "Scope", Tag::NA, 0, 0, 0),
+        Tag(547, "MDImplicitDelete", Tag::NA, 0, 0, 0),
+        Tag(548, "CrossID", Tag::NA, 0, 0, 0),
+        Tag(549, "CrossType", Tag::NA, 0, 0, 0),
+        Tag(550, "CrossPrioritization", Tag::NA, 0, 0, 0),
+        Tag(551, "OrigCrossID", Tag::NA, 0, 0, 0),
+        Tag(552, "NoSides", Tag::NA, 0, 0, 0),
+        Tag(553, "UserName", Tag::NA, 0, 0, 0),
+        Tag(554, "Password", Tag::NA, 0, 0, 0),
+        Tag(555, "NoLegs", Tag::NA, 0, 0, 0),
+        Tag(556, "LegCurrency", Tag::NA, 0, 0, 0),
+        Tag(557, "TotNoSecurityTypes", Tag::NA, 0, 0, 0),
+        Tag(558, "NoSecurityTypes", Tag::NA, 0, 0, 0),
+        Tag(559, "SecurityListRequestType", Tag::NA, 0, 0, 0),
+        Tag(560, "SecurityRequestResult", Tag::NA, 0, 0, 0),
+        Tag(561, "RoundLot", Tag::NA, 0, 0, 0),
+        Tag(562, "MinTradeVol", Tag::NA, 0, 0, 0),
+        Tag(563, "MultiLegRptTypeReq", Tag::NA, 0, 0, 0),
+        Tag(564, "LegPositionEffect", Tag::NA, 0, 0, 0),
+        Tag(565, "LegCoveredOrUncovered", Tag::NA, 0, 0, 0),
+        Tag(566, "LegPrice", Tag::NA, 0, 0, 0),
+        Tag(567, "TradSesStatusRejReason", Tag::NA, 0, 0, 0),
+        Tag(568, "TradeRequestID", Tag::NA, 0, 0, 0),
+        Tag(569, "TradeRequestType", Tag::NA, 0, 0, 0),
+        Tag(570, "PreviouslyReported", Tag::NA, 0, 0, 0),
+        Tag(571, "TradeReportID", Tag::NA, 0, 0, 0),
+        Tag(572, "TradeReportRefID", Tag::NA, 0, 0, 0),
+        Tag(573, "MatchStatus", Tag::NA, 0, 0, 0),
+        Tag(574, "MatchType", Tag::NA, 0, 0, 0),
+        Tag(575, "OddLot", Tag::NA, 0, 0, 0),
+        Tag(576, "NoClearingInstructions", Tag::NA, 0, 0, 0),
+        Tag(577, "ClearingInstruction", Tag::NA, 0, 0, 0),
+        Tag(578, "TradeInputSource", Tag::NA, 0, 0, 0),
+        Tag(579, "TradeInputDevice", Tag::NA, 0, 0, 0),
+        Tag(580, "NoDates", Tag::NA, 0, 0, 0),
+        Tag(581, "AccountType", Tag::NA, 0, 0, 0),
+        Tag(582, "CustOrderCapacity", Tag::NA, 0, 0, 0),
+        Tag(583, "ClOrdLinkID", Tag::NA, 0, 0, 0),
+        Tag(584, "MassStatusReqID", Tag::NA, 0, 0, 0),
+        Tag(585, "MassStatusReqType", Tag::NA, 0, 0, 0),
+        Tag(586, "OrigOrdModTime", Tag::NA, 0, 0, 0),
+        Tag(587, "LegSettlType", Tag::NA, 0, 0, 0),
+        Tag(588, "LegSettlDate", Tag::NA, 0, 0, 0),
+        Tag(589, "DayBookingInst", Tag::NA, 0, 0, 0),
+        Tag(590, "BookingUnit", Tag::NA, 0, 0, 0),
+        Tag(591, "PreallocMethod", Tag::NA, 0, 0, 0),
+        Tag(592, "UnderlyingCountryOfIssue", Tag::NA, 0, 0, 0),
+        Tag(593, "UnderlyingStateOrProvinceOfIssue", Tag::NA, 0, 0, 0),
+        Tag(594, "UnderlyingLocaleOfIssue", Tag::NA, 0, 0, 0),
+        Tag(595, "UnderlyingInstrRegistry", Tag::NA, 0, 0, 0),
+        Tag(596, "LegCountryOfIssue", Tag::NA, 0, 0, 0),
+        Tag(597, "LegStateOrProvinceOfIssue", Tag::NA, 0, 0, 0),
+        Tag(598, "LegLocaleOfIssue", Tag::NA, 0, 0, 0),
+        Tag(599, "LegInstrRegistry", Tag::NA, 0, 0, 0),
+        Tag(600, "LegSymbol", Tag::NA, 0, 0, 0),
+        Tag(601, "LegSymbolSfx", Tag::NA, 0, 0, 0),
+        Tag(602, "LegSecurityID", Tag::NA, 0, 0, 0),
+        Tag(603, "LegSecurityIDSource", Tag::NA, 0, 0, 0),
+        Tag(604, "NoLegSecurityAltID", Tag::NA, 0, 0, 0),
+        Tag(605, "LegSecurityAltID", Tag::NA, 0, 0, 0),
+        Tag(606, "LegSecurityAltIDSource", Tag::NA, 0, 0, 0),
+        Tag(607, "LegProduct", Tag::NA, 0, 0, 0),
+        Tag(608, "LegCFICode", Tag::NA, 0, 0, 0),
+        Tag(609, "LegSecurityType", Tag::NA, 0, 0, 0),
+        Tag(610, "LegMaturityMonthYear", Tag::NA, 0, 0, 0),
+        Tag(611, "LegMaturityDate", Tag::NA, 0, 0, 0),
+        Tag(612, "LegStrikePrice", Tag::NA, 0, 0, 0),
+        Tag(613, "LegOptAttribute", Tag::NA, 0, 0, 0),
+        Tag(614, "LegContractMultiplier", Tag::NA, 0, 0, 0),
+        Tag(615, "LegCouponRate", Tag::NA, 0, 0, 0),
+        Tag(616, "LegSecurityExchange", Tag::NA, 0, 0, 0),
+        Tag(617, "LegIssuer", Tag::NA, 0, 0, 0),
+        Tag(618, "EncodedLegIssuerLen", Tag::NA, 0, 0, 0),
+        Tag(619, "EncodedLegIssuer", Tag::NA, 0, 0, 0),
+        Tag(620, "LegSecurityDesc", Tag::NA, 0, 0, 0),
+        Tag(621, "EncodedLegSecurityDescLen", Tag::NA, 0, 0, 0),
+        Tag(622, "EncodedLegSecurityDesc", Tag::NA, 0, 0, 0),
+        Tag(623, "LegRatioQty", Tag::NA, 0, 0, 0),
+        Tag(624, "LegSide", Tag::NA, 0, 0, 0),
+        Tag(625, "TradingSessionSubID", Tag::NA, 0, 0, 0),
+        Tag(626, "AllocType", Tag::NA, 0, 0, 0),
+        Tag(627, "NoHops", Tag::NA, 0, 0, 0),
+        Tag(628, "HopCompID", Tag::NA, 0, 0, 0),
+        Tag(629, "HopSendingTime", Tag::NA, 0, 0, 0),
+        Tag(630, "HopRefID", Tag::NA, 0, 0, 0),
+        Tag(631, "MidPx", Tag::NA, 0, 0, 0),
+        Tag(632, "BidYield", Tag::NA, 0, 0, 0),
+        Tag(633, "MidYield", Tag::NA, 0, 0, 0),
+        Tag(634, "OfferYield", Tag::NA, 0, 0, 0),
+        Tag(635, "ClearingFeeIndicator", Tag::NA, 0, 0, 0),
+        Tag(636, "WorkingIndicator", Tag::NA, 0, 0, 0),
+        Tag(637, "LegLastPx", Tag::NA, 0, 0, 0),
+        Tag(638, "PriorityIndicator", Tag::NA, 0, 0, 0),
+        Tag(639, "PriceImprovement", Tag::NA, 0, 0, 0),
+        Tag(640, "Price2", Tag::NA, 0, 0, 0),
+        Tag(641, "LastForwardPoints2", Tag::NA, 0, 0, 0),
+        Tag(642, "BidForwardPoints2", Tag::NA, 0, 0, 0),
+        Tag(643, "OfferForwardPoints2", Tag::NA, 0, 0, 0),
+        Tag(644, "RFQReqID", Tag::NA, 0, 0, 0),
+        Tag(645, "MktBidPx", Tag::NA, 0, 0, 0),
+        Tag(646, "MktOfferPx", Tag::NA, 0, 0, 0),
+        Tag(647, "MinBidSize", Tag::NA, 0, 0, 0),
+        Tag(648, "MinOfferSize", Tag::NA, 0, 0, 0),
+        Tag(649, "QuoteStatusReqID", Tag::NA, 0, 0, 0),
+        Tag(650, "LegalConfirm", Tag::NA, 0, 0, 0),
+        Tag(651, "UnderlyingLastPx", Tag::NA, 0, 0, 0),
+        Tag(652, "UnderlyingLastQty", Tag::NA, 0, 0, 0),
+        Tag(653, "SecDefStatus", Tag::NA, 0, 0, 0),
+        Tag(654, "LegRefID", Tag::NA, 0, 0, 0),
+        Tag(655, "ContraLegRefID", Tag::NA, 0, 0, 0),
+        Tag(656, "SettlCurrBidFxRate", Tag::NA, 0, 0, 0),
+        Tag(657, "SettlCurrOfferFxRate", Tag::NA, 0, 0, 0),
+        Tag(658, "QuoteRequestRejectReason", Tag::NA, 0, 0, 0),
+        Tag(659, "SideComplianceID", Tag::NA, 0, 0, 0),
+        Tag(660, "AcctIDSource", Tag::NA, 0, 0, 0),
+        Tag(661, "AllocAcctIDSource", Tag::NA, 0, 0, 0),
+        Tag(662, "BenchmarkPrice", Tag::NA, 0, 0, 0),
+        Tag(663, "BenchmarkPriceType", Tag::NA, 0, 0, 0),
+        Tag(664, "ConfirmID", Tag::NA, 0, 0, 0),
+        Tag(665, "ConfirmStatus", Tag::NA, 0, 0, 0),
+        Tag(666, "ConfirmTransType", Tag::NA, 0, 0, 0),
+        Tag(667, "ContractSettlMonth", Tag::NA, 0, 0, 0),
+        Tag(668, "DeliveryForm", Tag::NA, 0, 0, 0),
+        Tag(669, "LastParPx", Tag::NA, 0, 0, 0),
+        Tag(670, "NoLegAllocs", Tag::NA, 0, 0, 0),
+        Tag(671, "LegAllocAccount", Tag::NA, 0, 0, 0),
+        Tag(672, "LegIndividualAllocID", Tag::NA, 0, 0, 0),
+        Tag(673, "LegAllocQty", Tag::NA, 0, 0, 0),
+        Tag(674, "LegAllocAcctIDSource", Tag::NA, 0, 0, 0),
+        Tag(675, "LegSettlCurrency", Tag::NA, 0, 0, 0),
+        Tag(676, "LegBenchmarkCurveCurrency", Tag::NA, 0, 0, 0),
+        Tag(677, "LegBenchmarkCurveName", Tag::NA, 0, 0, 0),
+        Tag(678, "LegBenchmarkCurvePoint", Tag::NA, 0, 0, 0),
+        Tag(679, "LegBenchmarkPrice", Tag::NA, 0, 0, 0),
+        Tag(680, "LegBenchmarkPriceType", Tag::NA, 0, 0, 0),
+        Tag(681, "LegBidPx", Tag::NA, 0, 0, 0),
+        Tag(682, "LegIOIQty", Tag::NA, 0, 0, 0),
+        Tag(683, "NoLegStipulations", Tag::NA, 0, 0, 0),
+        Tag(684, "LegOfferPx", Tag::NA, 0, 0, 0),
+        Tag(685, "LegOrderQty", Tag::NA, 0, 0, 0),
+        Tag(686, "LegPriceType", Tag::NA, 0, 0, 0),
+        Tag(687, "LegQty", Tag::NA, 0, 0, 0),
+        Tag(688, "LegStipulationType", Tag::NA, 0, 0, 0),
+        Tag(689, "LegStipulationValue", Tag::NA, 0, 0, 0),
+        Tag(690, "LegSwapType", Tag::NA, 0, 0, 0),
+        Tag(691, "Pool", Tag::NA, 0, 0, 0),
+        Tag(692, "QuotePriceType", Tag::NA, 0, 0, 0),
+        Tag(693, "QuoteRespID", Tag::NA, 0, 0, 0),
+        Tag(694, "QuoteRespType", Tag::NA, 0, 0, 0),
+        Tag(695, "QuoteQualifier", Tag::NA, 0, 0, 0),
+        Tag(696, "YieldRedemptionDate", Tag::NA, 0, 0, 0),
+        Tag(697, "YieldRedemptionPrice", Tag::NA, 0, 0, 0),
+        Tag(698, "YieldRedemptionPriceType", Tag::NA, 0, 0, 0),
+        Tag(699, "BenchmarkSecurityID", Tag::NA, 0, 0, 0),
+        Tag(700, "ReversalIndicator", Tag::NA, 0, 0, 0),
+        Tag(701, "YieldCalcDate", Tag::NA, 0, 0, 0),
+        Tag(702, "NoPositions", Tag::NA, 0, 0, 0),
+        Tag(703, "PosType", Tag::NA, 0, 0, 0),
+        Tag(704, "LongQty", Tag::NA, 0, 0, 0),
+        Tag(705, "ShortQty", Tag::NA, 0, 0, 0),
+        Tag(706, "PosQtyStatus", Tag::NA, 0, 0, 0),
+        Tag(707, "PosAmtType", Tag::NA, 0, 0, 0),
+        Tag(708, "PosAmt", Tag::NA, 0, 0, 0),
+        Tag(709, "PosTransType", Tag::NA, 0, 0, 0),
+        Tag(710, "PosReqID", Tag::NA, 0, 0, 0),
+        Tag(711, "NoUnderlyings", Tag::NA, 0, 0, 0),
+        Tag(712, "PosMaintAction", Tag::NA, 0, 0, 0),
+        Tag(713, "OrigPosReqRefID", Tag::NA, 0, 0, 0),
+        Tag(714, "PosMaintRptRefID", Tag::NA, 0, 0, 0),
+        Tag(715, "ClearingBusinessDate", Tag::NA, 0, 0, 0),
+        Tag(716, "SettlSessID", Tag::NA, 0, 0, 0),
+        Tag(717, "SettlSessSubID", Tag::NA, 0, 0, 0),
+        Tag(718, "AdjustmentType", Tag::NA, 0, 0, 0),
+        Tag(719, "ContraryInstructionIndicator", Tag::NA, 0, 0, 0),
+        Tag(720, "PriorSpreadIndicator", Tag::NA, 0, 0, 0),
+        Tag(721, "PosMaintRptID", Tag::NA, 0, 0, 0),
+        Tag(722, "PosMaintStatus", Tag::NA, 0, 0, 0),
+        Tag(723, "PosMaintResult", Tag::NA, 0, 0, 0),
+        Tag(724, "PosReqType", Tag::NA, 0, 0, 0),
+        Tag(725, "ResponseTransportType", Tag::NA, 0, 0, 0),
+        Tag(726, "ResponseDestination", Tag::NA, 0, 0, 0),
+        Tag(727, "TotalNumPosReports", Tag::NA, 0, 0, 0),
+        Tag(728, "PosReqResult", Tag::NA, 0, 0, 0),
+        Tag(729, "PosReqStatus", Tag::NA, 0, 0, 0),
+        Tag(730, "SettlPrice", Tag::NA, 0, 0, 0),
+        Tag(731, "SettlPriceType", Tag::NA, 0, 0, 0),
+        Tag(732, "UnderlyingSettlPrice", Tag::NA, 0, 0, 0),
+        Tag(733, "UnderlyingSettlPriceType", Tag::NA, 0, 0, 0),
+        Tag(734, "PriorSettlPrice", Tag::NA, 0, 0, 0),
+        Tag(735, "NoQuoteQualifiers", Tag::NA, 0, 0, 0),
+        Tag(736, "AllocSettlCurrency", Tag::NA, 0, 0, 0),
+        Tag(737, "AllocSettlCurrAmt", Tag::NA, 0, 0, 0),
+        Tag(738, "InterestAtMaturity", Tag::NA, 0, 0, 0),
+        Tag(739, "LegDatedDate", Tag::NA, 0, 0, 0),
+        Tag(740, "LegPool", Tag::NA, 0, 0, 0),
+        Tag(741, "AllocInterestAtMaturity", Tag::NA, 0, 0, 0),
+        Tag(742, "AllocAccruedInterestAmt", Tag::NA, 0, 0, 0),
+        Tag(743, "DeliveryDate", Tag::NA, 0, 0, 0),
+        Tag(744, "AssignmentMethod", Tag::NA, 0, 0, 0),
+        Tag(745, "AssignmentUnit", Tag::NA, 0, 0, 0),
+        Tag(746, "OpenInterest", Tag::NA, 0, 0, 0),
+        Tag(747, "ExerciseMethod", Tag::NA, 0, 0, 0),
+        Tag(748, "TotNumTradeReports", Tag::NA, 0, 0, 0),
+        Tag(749, "TradeRequestResult", Tag::NA, 0, 0, 0),
+        Tag(750, "TradeRequestStatus", Tag::NA, 0, 0, 0),
+        Tag(751, "TradeReportRejectReason", Tag::NA, 0, 0, 0),
+        Tag(752, "SideMultiLegReportingType", Tag::NA, 0, 0, 0),
+        Tag(753, "NoPosAmt", Tag::NA, 0, 0, 0),
+        Tag(754, "AutoAcceptIndicator", Tag::NA, 0, 0, 0),
+        Tag(755, "AllocReportID", Tag::NA, 0, 0, 0),
+        Tag(756, "NoNested2PartyIDs", Tag::NA, 0, 0, 0),
+        Tag(757, "Nested2PartyID", Tag::NA, 0, 0, 0),
+        Tag(758, "Nested2PartyIDSource", Tag::NA, 0, 0, 0),
+        Tag(759, "Nested2PartyRole", Tag::NA, 0, 0, 0),
+        Tag(760, "Nested2PartySubID", Tag::NA, 0, 0, 0),
+        Tag(761, "BenchmarkSecurityIDSource", Tag::NA, 0, 0, 0),
+        Tag(762, "SecuritySubType", Tag::NA, 0, 0, 0),
+        Tag(763, "UnderlyingSecuritySubType", Tag::NA, 0, 0, 0),
+        Tag(764, "LegSecuritySubType", Tag::NA, 0, 0, 0),
+        Tag(765, "AllowableOneSidednessPct", Tag::NA, 0, 0, 0),
+        Tag(766, "AllowableOneSidednessValue", Tag::NA, 0, 0, 0),
+        Tag(767, "AllowableOneSidednessCurr", Tag::NA, 0, 0, 0),
+        Tag(768, "NoTrdRegTimestamps", Tag::NA, 0, 0, 0),
+        Tag(769, "TrdRegTimestamp", Tag::NA, 0, 0, 0),
+        Tag(770, "TrdRegTimestampType", Tag::NA, 0, 0, 0),
+        Tag(771, "TrdRegTimestampOrigin", Tag::NA, 0, 0, 0),
+        Tag(772, "ConfirmRefID", Tag::NA, 0, 0, 0),
+        Tag(773, "ConfirmType", Tag::NA, 0, 0, 0),
+        Tag(774, "ConfirmRejReason", Tag::NA, 0, 0, 0),
+        Tag(775, "BookingType", Tag::NA, 0, 0, 0),
+        Tag(776, "IndividualAllocRejCode", Tag::NA, 0, 0, 0),
+        Tag(777, "SettlInstMsgID", Tag::NA, 0, 0, 0),
+        Tag(778, "NoSettlInst", Tag::NA, 0, 0, 0),
+        Tag(779, "LastUpdateTime", Tag::NA, 0, 0, 0),
+        Tag(780, "AllocSettlInstType", Tag::NA, 0, 0, 0),
+        Tag(781, "NoSettlPartyIDs", Tag::NA, 0, 0, 0),
+        Tag(782, "SettlPartyID", Tag::NA, 0, 0, 0),
+        Tag(783, "SettlPartyIDSource", Tag::NA, 0, 0, 0),
+        Tag(784, "SettlPartyRole", Tag::NA, 0, 0, 0),
+        Tag(785, "SettlPartySubID", Tag::NA, 0, 0, 0),
+        Tag(786, "SettlPartySubIDType", Tag::NA, 0, 0, 0),
+        Tag(787, "DlvyInstType", Tag::NA, 0, 0, 0),
+        Tag(788, "TerminationType", Tag::NA, 0, 0, 0),
+        Tag(789, "NextExpectedMsgSeqNum", Tag::NA, 0, 0, 0),
+    };
+
+namespace dictionary {
+
+    constexpr size_t size = std::size(TAGS);
+    constexpr int max_id = TAGS[size - 1].id;
+
+    // TAGS position of every id, -1 for ids that aren't tags
+    inline constexpr auto by_id = [] {
+        std::array<int16_t, max_id + 1> table {};
+        for (auto & position : table) {
+            position = -1;
+        }
+        for (size_t i = 0; i < size; ++i) {
+            table[TAGS[i].id] = static_cast<int16_t>(i);
+        }
+        return table;
+    }();
+
+    constexpr uint64_t hash(std::string_view name) {
+        uint64_t hash = 14695981039346656037ull;
+        for (auto c : name) {
+            hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    // Names are looked up through a perfect hash (hash and displace): a
+    // name's bucket holds the displacement d that, for every name in the
+    // bucket, lands slot(hash, d) on a distinct free slot of the table.
+    // All of it is worked out at compile time.
+    constexpr size_t buckets = 256;
+    constexpr size_t slots = 1024;
+
+    constexpr size_t bucket(uint64_t hash) { return hash % buckets; }
+    constexpr size_t slot(uint64_t hash, size_t d) { return ((hash >> 16) + d * ((hash >> 40) | 1)) % slots; }
+
+    struct NameTable {
+        std::array<uint16_t, buckets> displacements;
+        std::array<int16_t, slots> positions;
+    };
+
+    inline constexpr NameTable by_name = [] {
+        NameTable table {};
+        std::array<uint64_t, size> hashes {};
+        std::array<size_t, buckets + 1> starts {};
+        std::array<int16_t, size> members {};
+        
+        for (size_t i = 0; i < size; ++i) {
+            hashes[i] = hash(TAGS[i].name);
+            ++starts[bucket(hashes[i]) + 1];
+        }
+        for (size_t b = 0; b < buckets; ++b) {
+            starts[b + 1] += starts[b];
+        }
+        auto fill = starts;
+        for (size_t i = 0; i < size; ++i) {
+            members[fill[bucket(hashes[i])]++] = static_cast<int16_t>(i);
+        }
+        for (auto & position : table.positions) {
+            position = -1;
+        }
+        
+        size_t largest = 0;
+        for (size_t b = 0; b < buckets; ++b) {
+            largest = std::max(largest, starts[b + 1] - starts[b]);
+        }
+        
+        // fullest buckets first, while there's still room to choose from
+        for (auto count = largest; count > 0; --count) {
+            for (size_t b = 0; b < buckets; ++b) {
+                if (starts[b + 1] - starts[b] != count) {
+                    continue;
+                }
+                
+                for (size_t d = 0; ; ++d) {
+                    bool fits = true;
+                    for (auto i = starts[b]; fits && i < starts[b + 1]; ++i) {
+                        auto s = slot(hashes[members[i]], d);
+                        fits = table.positions[s] < 0;
+                        for (auto j = starts[b]; fits && j < i; ++j) {
+                            fits = slot(hashes[members[j]], d) != s;
+                        }
+                    }
+                    
+                    if (fits) {
+                        table.displacements[b] = static_cast<uint16_t>(d);
+                        for (auto i = starts[b]; i < starts[b + 1]; ++i) {
+                            table.positions[slot(hashes[members[i]], d)] = members[i];
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+        
+        return table;
+    }();
+
+}
+
+    // the tag with this id or name, nullptr if there's none
+    constexpr const Tag * find(int id) {
+        auto position = id >= 0 && id <= dictionary::max_id ? dictionary::by_id[id] : -1;
+        return position < 0 ? nullptr : &TAGS[position];
+    }
+
+    constexpr const Tag * find(std::string_view name) {
+        auto hash = dictionary::hash(name);
+        auto position = dictionary::by_name.positions[dictionary::slot(hash, dictionary::by_name.displacements[dictionary::bucket(hash)])];
+        return position >= 0 && TAGS[position].name == name ? &TAGS[position] : nullptr;
+    }
+
+    constexpr bool known(int id) {
+        return id >= 0 && id <= dictionary::max_id && dictionary::by_id[id] >= 0;
+    }
+
+    // compile time access, e.g. to specialize a decoder per tag
+    template <int Id>
+    inline constexpr const Tag & tag = *find(Id);
+
+    constexpr const Tag & Tag::BeginString = tag<8>;
+    constexpr const Tag & Tag::Checksum = tag<10>;
+    constexpr const Tag & Tag::MsgType = tag<35>;
+
 }
 }
 
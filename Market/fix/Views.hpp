@@ -0,0 +1,92 @@
+//
+//  Views.hpp
+//  Market
+//
+//  Created by Blagovest on 15/12/20.
+//
+
+#ifndef Fix_Views_hpp
+#define Fix_Views_hpp
+
+#include <optional>
+#include <string_view>
+
+#include "Fields.hpp"
+
+namespace mkt {
+namespace fix {
+
+    // Typed access to a parsed message. Nothing is decoded up front; each
+    // accessor finds its field and decodes it (see Fields.hpp) when called,
+    // nullopt if it's missing or malformed. Fields is any storage with
+    // get(tag) -> optional<string_view>, e.g. IndexedStoragePolicy from
+    // Parser::fields(), and has to outlive the view.
+    template <typename Fields>
+    class MessageView {
+        const Fields & fields;
+    public:
+        MessageView(const Fields & fields): fields(fields) {}
+        
+        template <int Id>
+        std::optional<field_type_t<Id>> get() const {
+            auto value = fields.get(Id);
+            return value ? decode<Id>(*value) : std::nullopt;
+        }
+        
+        auto msg_type() const { return get<35>(); }
+        auto sender_comp_id() const { return get<49>(); }
+        auto target_comp_id() const { return get<56>(); }
+        auto msg_seq_num() const { return get<34>(); }
+        auto sending_time() const { return get<52>(); }
+        auto poss_dup_flag() const { return get<43>(); }
+    };
+
+    // 35=D
+    template <typename Fields>
+    class NewOrderSingleView: public MessageView<Fields> {
+    public:
+        static constexpr std::string_view msg_type_value = "D";
+        
+        NewOrderSingleView(const Fields & fields): MessageView<Fields>(fields) {}
+        
+        auto cl_ord_id() const { return this->template get<11>(); }
+        auto account() const { return this->template get<1>(); }
+        auto symbol() const { return this->template get<55>(); }
+        auto side() const { return this->template get<54>(); }
+        auto order_qty() const { return this->template get<38>(); }
+        auto ord_type() const { return this->template get<40>(); }
+        auto price() const { return this->template get<44>(); }
+        auto stop_px() const { return this->template get<99>(); }
+        auto time_in_force() const { return this->template get<59>(); }
+        auto transact_time() const { return this->template get<60>(); }
+    };
+
+    // 35=8
+    template <typename Fields>
+    class ExecutionReportView: public MessageView<Fields> {
+    public:
+        static constexpr std::string_view msg_type_value = "8";
+        
+        ExecutionReportView(const Fields & fields): MessageView<Fields>(fields) {}
+        
+        auto order_id() const { return this->template get<37>(); }
+        auto cl_ord_id() const { return this->template get<11>(); }
+        auto exec_id() const { return this->template get<17>(); }
+        auto exec_type() const { return this->template get<150>(); }
+        auto ord_status() const { return this->template get<39>(); }
+        auto symbol() const { return this->template get<55>(); }
+        auto side() const { return this->template get<54>(); }
+        auto order_qty() const { return this->template get<38>(); }
+        auto price() const { return this->template get<44>(); }
+        auto last_qty() const { return this->template get<32>(); }
+        auto last_px() const { return this->template get<31>(); }
+        auto leaves_qty() const { return this->template get<151>(); }
+        auto cum_qty() const { return this->template get<14>(); }
+        auto avg_px() const { return this->template get<6>(); }
+        auto transact_time() const { return this->template get<60>(); }
+    };
+
+}
+}
+
+#endif /* Views_hpp */
@@ -3,28 +3,68 @@
 #include <iostream>
 #include <fstream>
 #include <cmath>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <tuple>
 
 #include "csv/Parser.hpp"
 #include "csv/Schemas.hpp"
 #include "csv/Reader.hpp"
 #include "csv/Interpreter.hpp"
+#include "csv/ParallelInterpreter.hpp"
 
 #include "equity/Move.hpp"
+#include "equity/TickStore.hpp"
+#include "equity/TickCodec.hpp"
+#include "equity/MoveBatch.hpp"
 
 #include "math/Stats.hpp"
 
 #include "util/CandleStick.hpp"
 #include "util/OrderBook.hpp"
+#include "util/RingBuffer.hpp"
+#include "util/BookManager.hpp"
+#include "util/SymbolTable.hpp"
 
 #include "simulate/RandomWalk.hpp"
 #include "fix/Parser.hpp"
+#include "fix/Framer.hpp"
+#include "fix/Batch.hpp"
+#include "fix/Views.hpp"
+#include "fix/Encoder.hpp"
+#include "fix/Groups.hpp"
 
+// every call to the global allocator, for tests asserting there are none
+static std::atomic<size_t> global_allocations = 0;
+
+void * operator new(size_t size) {
+    ++global_allocations;
+    if (auto block = std::malloc(size ? size : 1)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void * operator new(size_t size, std::align_val_t align) {
+    ++global_allocations;
+    void * block = nullptr;
+    if (!posix_memalign(&block, std::max(static_cast<size_t>(align), sizeof(void *)), size ? size : 1)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+// out of line, or gcc sees free() on what new returned and warns
+[[gnu::noinline]] void operator delete(void * block) noexcept { std::free(block); }
+[[gnu::noinline]] void operator delete(void * block, size_t) noexcept { std::free(block); }
+[[gnu::noinline]] void operator delete(void * block, std::align_val_t) noexcept { std::free(block); }
+[[gnu::noinline]] void operator delete(void * block, size_t, std::align_val_t) noexcept { std::free(block); }
+
+template <typename BidsDatabase, typename AsksDatabase>
 void test_order_book() {
     using Order = mkt::util::SimpleOrder<double, unsigned>;
-    using OrderBook = mkt::util::OrderBook<Order,
-        mkt::util::MultisetOrderDatabase<Order, std::multiset<Order, mkt::util::cheaper<Order>>>,
-        mkt::util::MultisetOrderDatabase<Order, std::multiset<Order, mkt::util::more_expensive<Order>>>,
-        mkt::util::VolumeWeighedPriceEvaluationPolicy>;
+    using OrderBook = mkt::util::OrderBook<Order, BidsDatabase, AsksDatabase, mkt::util::VolumeWeighedPriceEvaluationPolicy>;
     
     OrderBook book;
     
@@ -35,24 +75,272 @@ void test_order_book() {
     
     book.ask({1.7, 2u});
     std::cerr << book.price() << std::endl;
+    
+    // an order that is its own id is found by what's left of it after fills
+    OrderBook fills;
+    fills.bid({2, 10u});
+    fills.ask({2, 3u});
+    assert (!fills.cancel(Order {2, 10u}) && fills.cancel(Order {2, 7u}) && !fills.best_bid());
+    
+    // and not at all once it's filled, not even through the order now in its place
+    fills.bid({2, 10u});
+    fills.ask({2, 3u});
+    fills.ask({2, 7u});
+    fills.bid({3, 5u});
+    assert (!fills.cancel(Order {2, 10u}) && !fills.cancel(Order {2, 7u}) && fills.best_bid() == 3);
+    
+    // the same after reducing it, then replacing and cancelling what's left
+    OrderBook reduced;
+    reduced.bid({2, 10u});
+    assert (reduced.reduce(Order {2, 10u}, 4u) && !reduced.cancel(Order {2, 10u}));
+    assert (reduced.replace(Order {2, 6u}, 5u, 2) && !reduced.replace(Order {2, 6u}, 4u, 2));
+    assert (reduced.replace(Order {2, 5u}, 5u, 2.5) && reduced.best_bid() == 2.5);
+    assert (reduced.reduce(Order {2.5, 5u}, 1u) && reduced.cancel(Order {2.5, 4u}) && !reduced.best_bid());
+}
+
+void test_order_books() {
+    using Order = mkt::util::SimpleOrder<double, unsigned>;
+    
+    test_order_book<
+        mkt::util::MultisetOrderDatabase<Order, std::multiset<Order, mkt::util::cheaper<Order>>>,
+        mkt::util::MultisetOrderDatabase<Order, std::multiset<Order, mkt::util::more_expensive<Order>>>>();
+    test_order_book<
+        mkt::util::PriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PriceLevelOrderDatabase<Order, std::greater<>>>();
+}
+
+void test_fixed_price_order_book() {
+    using Price = mkt::util::FixedPrice<4>;
+    using Order = mkt::util::SimpleOrder<Price, unsigned>;
+    using OrderBook = mkt::util::OrderBook<Order,
+        mkt::util::PriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PriceLevelOrderDatabase<Order, std::greater<>>,
+        mkt::util::VolumeWeighedPriceEvaluationPolicy>;
+    
+    OrderBook book;
+    
+    book.bid({Price::parse("2"), 1u});
+    book.bid({Price::parse("1.5"), 5u});
+    book.ask({Price::parse("1.70005"), 2u});
+    
+    std::cerr << book.best_bid().value() << " " << book.best_ask().value() << " " << book.price() << std::endl;
+    
+    // weighted mids round once, to the nearest tick of the exact value
+    OrderBook weighed;
+    weighed.bid({Price::parse("1.0001"), 1u});
+    weighed.ask({Price::parse("1.0002"), 1u});
+    assert (weighed.price().ticks() == 10002);
+    
+    mkt::util::OrderBook<Order,
+        mkt::util::PriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PriceLevelOrderDatabase<Order, std::greater<>>,
+        mkt::util::AveragePriceEvaluationPolicy> average;
+    average.bid({Price::parse("1.0001"), 1u});
+    average.ask({Price::parse("1.0003"), 1u});
+    assert (average.price().ticks() == 10002);
+}
+
+template <typename BidsDatabase, typename AsksDatabase>
+void test_pooled_order_book() {
+    using Order = mkt::util::IdentifiedOrder<long, mkt::util::FixedPrice<4>, unsigned>;
+    using Price = mkt::util::FixedPrice<4>;
+    using OrderBook = mkt::util::OrderBook<Order, BidsDatabase, AsksDatabase, mkt::util::BidPriceEvaluationPolicy>;
+    
+    OrderBook book (std::piecewise_construct, std::make_tuple(mkt::util::order_id<Order>(), size_t(1024)), std::make_tuple(mkt::util::order_id<Order>(), size_t(1024)));
+    
+    // a ladder each side, a sweep through the bids, the rest cancelled
+    auto session = [&book] (long id) {
+        for (int i = 0; i < 256; ++i) {
+            book.bid({id + 2 * i, Price::from_ticks(10000 - i % 8), 10u});
+            book.ask({id + 2 * i + 1, Price::from_ticks(10010 + i % 8), 10u});
+        }
+        book.ask({id + 512, Price::from_ticks(9990), 1000u});
+        for (int i = 0; i < 256; ++i) {
+            book.reduce(id + 2 * i, 5u);
+        }
+        for (int i = 0; i < 512; ++i) {
+            book.cancel(id + i);
+        }
+    };
+    
+    // not even the first order allocates once the slabs are carved out
+    book.warm({-1, Price(1), 1u});
+    auto allocations = global_allocations.load();
+    session(0);
+    session(1000);
+    
+    assert (global_allocations == allocations);
+    assert (!book.best_bid() && !book.best_ask());
+}
+
+void test_pooled_order_book() {
+    using Order = mkt::util::IdentifiedOrder<long, mkt::util::FixedPrice<4>, unsigned>;
+    
+    test_pooled_order_book<
+        mkt::util::PooledMultisetOrderDatabase<Order, mkt::util::cheaper<Order>>,
+        mkt::util::PooledMultisetOrderDatabase<Order, mkt::util::more_expensive<Order>>>();
+    test_pooled_order_book<
+        mkt::util::PooledPriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PooledPriceLevelOrderDatabase<Order, std::greater<>>>();
+    test_pooled_order_book<
+        mkt::util::PooledPriceLevelOrderDatabase<Order, std::less<>, 1024, true>,
+        mkt::util::PooledPriceLevelOrderDatabase<Order, std::greater<>, 1024, true>>();
+    // the price level one needs no pool, given its capacity
+    test_pooled_order_book<
+        mkt::util::PriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PriceLevelOrderDatabase<Order, std::greater<>>>();
+}
+
+template <typename BidsDatabase, typename AsksDatabase>
+void test_order_book_amendments() {
+    using Order = mkt::util::IdentifiedOrder<long, double, unsigned>;
+    using OrderBook = mkt::util::OrderBook<Order, BidsDatabase, AsksDatabase, mkt::util::BidPriceEvaluationPolicy>;
+    
+    OrderBook book;
+    
+    book.bid({1, 2, 10u});
+    book.bid({2, 2, 10u});
+    book.bid({3, 1.5, 5u});
+    book.reduce(1, 4u);
+    book.cancel(2);
+    std::cerr << book.price() << std::endl;
+    
+    book.replace(3, 5u, 2.5);
+    std::cerr << book.price() << std::endl;
+}
+
+void test_order_book_amendments() {
+    using Order = mkt::util::IdentifiedOrder<long, double, unsigned>;
+    
+    test_order_book_amendments<
+        mkt::util::MultisetOrderDatabase<Order, std::multiset<Order, mkt::util::cheaper<Order>>>,
+        mkt::util::MultisetOrderDatabase<Order, std::multiset<Order, mkt::util::more_expensive<Order>>>>();
+    test_order_book_amendments<
+        mkt::util::PriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PriceLevelOrderDatabase<Order, std::greater<>>>();
+}
+
+void test_order_book_executions() {
+    using Order = mkt::util::IdentifiedOrder<long, double, unsigned>;
+    using Trade = mkt::util::Trade<long, double, unsigned>;
+    using OrderBook = mkt::util::OrderBook<Order,
+        mkt::util::PriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PriceLevelOrderDatabase<Order, std::greater<>>,
+        mkt::util::AveragePriceEvaluationPolicy,
+        mkt::util::RingBuffer<Trade, 64>>;
+    
+    OrderBook book;
+    
+    book.ask({1, 1.7, 2u});
+    book.ask({2, 1.8, 2u});
+    book.bid({3, 1.8, 3u});
+    
+    book.executions().drain([] (const Trade & trade) {
+        std::cerr << trade.seq << ": " << trade.aggressor_id << " x " << trade.passive_id << " " << trade.quantity << "@" << trade.price << std::endl;
+    });
+    
+    auto [bids, asks] = book.depth(5);
+    for (auto & level : asks) {
+        std::cerr << "ask " << level.quantity << "@" << level.price << std::endl;
+    }
+    for (auto & level : bids) {
+        std::cerr << "bid " << level.quantity << "@" << level.price << std::endl;
+    }
+}
+
+void test_book_manager() {
+    using Order = mkt::util::IdentifiedOrder<long, double, unsigned>;
+    using OrderBook = mkt::util::OrderBook<Order,
+        mkt::util::PriceLevelOrderDatabase<Order, std::less<>>,
+        mkt::util::PriceLevelOrderDatabase<Order, std::greater<>>,
+        mkt::util::AveragePriceEvaluationPolicy>;
+    using Event = mkt::util::BookEvent<Order>;
+    
+    // a book that fails to construct leaves no symbol behind
+    struct FussyBook: OrderBook {
+        FussyBook(bool fail = false) {
+            if (fail) {
+                throw std::invalid_argument("no book");
+            }
+        }
+    };
+    
+    mkt::util::BookManager<FussyBook> fussy(1);
+    fussy.add("AAPL");
+    bool thrown = false;
+    try {
+        fussy.add("MSFT", true);
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    assert (thrown && !fussy.id("MSFT") && fussy.add("IBM") == 1 && fussy.size() == 2);
+    
+    mkt::util::BookManager<OrderBook> manager(2);
+    
+    auto aapl = manager.add("AAPL");
+    auto msft = manager.add("MSFT");
+    manager.start();
+    
+    manager.route({aapl, Event::BID, {1, 188.5, 100u}});
+    manager.route({aapl, Event::ASK, {2, 188.7, 50u}});
+    manager.route({msft, Event::BID, {3, 210.1, 10u}});
+    manager.route({msft, Event::CANCEL, {3, 0, 0u}});
+    manager.flush();
+    
+    manager.for_each_top([&manager] (auto symbol, auto quote) {
+        std::cerr << manager.symbol(symbol) << " bid=" << quote.bid.value_or(0) << " ask=" << quote.ask.value_or(0) << std::endl;
+    });
+    
+    // stop() applies everything routed before it, flushed or not
+    manager.route({msft, Event::BID, {4, 210.2, 10u}});
+    manager.stop();
+    assert (manager.book(msft).best_bid() == 210.2);
+}
+
+void test_csv_tokenizer() {
+    using Lines = std::vector<std::vector<std::string>>;
+    
+    // copied, since an unescaped value only lasts until the next line
+    auto split = [] (std::string_view buffer) {
+        mkt::csv::scanner::Tokenizer tokenizer (buffer);
+        std::vector<std::string_view> values;
+        Lines lines;
+        while (tokenizer.read_next_line(values)) {
+            lines.emplace_back(values.begin(), values.end());
+        }
+        return lines;
+    };
+    
+    assert (split("") == Lines {});
+    assert (split("\n\r\n") == Lines {});
+    assert (split("a,b") == (Lines { { "a", "b" } }));
+    // a trailing delimiter is followed by an empty value, newline or not
+    assert (split("a,") == (Lines { { "a", "" } }));
+    assert (split("a,\n") == (Lines { { "a", "" } }));
+    assert (split(",") == (Lines { { "", "" } }));
+    // a quoted empty value isn't a blank line
+    assert (split("a\n\n\"\"\nb") == (Lines { { "a" }, { "" }, { "b" } }));
+    assert (split("\"a\"\"b\",\"\"\"\"\r\n\"c,\nd\"") == (Lines { { "a\"b", "\"" }, { "c,\nd" } }));
+    
+    // across the end of a 64 byte block
+    auto x = std::string(60, 'x'), y = std::string(10, 'y');
+    assert (split("\"" + x + "\"\"" + y + "\",z\n\"\"\"\",") == (Lines { { x + "\"" + y, "z" }, { "\"", "" } }));
 }
 
 void test_csv_reader() {
-    std::ifstream in("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv");
+    mkt::csv::MappedReader reader ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv");
     
-    if (!in) {
+    if (!reader) {
         std::cerr << strerror(errno);
         return;
     }
     
-    mkt::csv::Reader reader (in);
-    
-    mkt::csv::Interpreter<mkt::equity::Move> csv(reader);
+    mkt::csv::Interpreter<mkt::equity::Move, ',', decltype(reader)> csv(reader);
     
     auto headers = csv.get_headers();
     auto row = mkt::equity::Move();
     
-    std::vector<decltype(row)> rows;
+    mkt::equity::MoveBatch rows;
     
     mkt::util::CandleStick<decltype(row.bid.price)> w {};
     
@@ -64,8 +352,247 @@ void test_csv_reader() {
             std::cerr << w << std::endl;
             w.reset();
         }
-        rows.push_back(row);
+        rows.append(row);
+    }
+}
+
+void test_parallel_csv_reader() {
+    mkt::csv::ParallelInterpreter<mkt::equity::Move> csv ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv", 4, 64 << 10);
+    
+    if (!csv) {
+        std::cerr << strerror(errno);
+        return;
+    }
+    
+    size_t rows = 0;
+    auto last = std::chrono::system_clock::time_point::min();
+    
+    csv.for_each([&] (const mkt::equity::Move & row) {
+        ++rows;
+        last = std::max(last, row.event.time);
+    });
+    
+    std::atomic<size_t> batched = 0;
+    csv.for_each_batch([&] (size_t, std::vector<mkt::equity::Move> & rows) {
+        batched += rows.size();
+    });
+    
+    assert (rows == batched);
+    
+    // a throwing consumer stops the workers and gets its exception back
+    for (auto batch : { false, true }) {
+        bool thrown = false;
+        try {
+            if (batch) {
+                csv.for_each_batch([] (size_t, auto &) { throw std::runtime_error("stop"); });
+            } else {
+                csv.for_each([] (auto &) { throw std::runtime_error("stop"); });
+            }
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        assert (thrown);
+    }
+    
+    size_t again = 0;
+    csv.for_each([&] (auto &) { ++again; });
+    assert (again == rows);
+    std::cerr << rows << " rows in " << csv.size() << " chunks, " << csv.rejected() << " rejected" << std::endl;
+}
+
+void test_csv_binding() {
+    struct Quote {
+        std::string_view symbol;
+        char xcode;
+        mkt::equity::Price bid, ask;
+        unsigned bid_size, ask_size;
+    };
+    
+    mkt::csv::MappedReader reader ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv");
+    
+    if (!reader) {
+        std::cerr << strerror(errno);
+        return;
+    }
+    
+    // sizes aren't needed, so they're never converted
+    using Binding = mkt::csv::schema::Binding<Quote, &Quote::symbol, &Quote::xcode, &Quote::bid, &Quote::ask, &Quote::bid_size, &Quote::ask_size>;
+    Binding binding ({ "EventSymbol", "ExchangeCode", "BidPrice", "AskPrice", "BidSize", "AskSize" }, reader.get_headers(), Binding::Mask("110000"));
+    assert (binding.bound(0) && binding.column(2) == 6 && !binding.bound(4));
+    
+    // a missing column is an error unless its member is skipped
+    using Names = std::array<std::string_view, 6>;
+    Names missing { "EventSymbol", "ExchangeCode", "BidPrice", "AskPrice", "BidSize", "Volume" };
+    bool thrown = false;
+    try {
+        Binding (missing, reader.get_headers());
+    } catch (const std::invalid_argument &) {
+        thrown = true;
+    }
+    assert (thrown && !Binding(missing, reader.get_headers(), Binding::Mask("100000")).bound(5));
+    
+    decltype(reader)::Values values;
+    Quote quote {};
+    auto spread = mkt::equity::Price();
+    size_t rows = 0;
+    
+    while (reader.read_next_line(values)) {
+        if (binding.from(values, quote)) {
+            spread = spread + (quote.ask - quote.bid);
+            ++rows;
+        }
+    }
+    
+    std::cerr << rows << " " << quote.symbol << " quotes, average spread " << spread / static_cast<int64_t>(rows) << std::endl;
+}
+
+void test_tick_store() {
+    auto rows = mkt::equity::convert("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv", "/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.ticks", 1024);
+    
+    if (rows < 0) {
+        std::cerr << strerror(errno);
+        return;
+    }
+    
+    mkt::equity::TickStore store ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.ticks");
+    assert (store && store.size() == static_cast<size_t>(rows));
+    
+    auto first = store.move(0);
+    auto [begin, end] = store.range(first.event.time, first.event.time);
+    assert (begin == 0 && end > 0 && first.event.symbol == "AAPL");
+    
+    int64_t spread = 0;
+    for (size_t i = 0; i < store.size(); ++i) {
+        spread += store.ask_prices()[i] - store.bid_prices()[i];
+    }
+    
+    std::cerr << rows << " rows, average spread " << mkt::equity::Price::from_ticks(spread / rows) << ", " << store.string(store.market_makers()[0]) << " first" << std::endl;
+    
+    // a symbol id with no string behind it makes the whole file invalid
+    std::ifstream in ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.ticks", std::ios::binary);
+    std::string bytes ((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    auto header = reinterpret_cast<const mkt::equity::tick_store::Header *>(bytes.data());
+    uint32_t bad_id = header->strings;
+    std::memcpy(&bytes[header->columns[mkt::equity::tick_store::Column::SYMBOL]], &bad_id, sizeof(bad_id));
+    std::ofstream("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.bad.ticks", std::ios::binary) << bytes;
+    
+    mkt::equity::TickStore bad ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.bad.ticks");
+    assert (!bad && bad.size() == 0 && bad.range(first.event.time, first.event.time) == std::make_pair(size_t(0), size_t(0)));
+}
+
+void test_tick_codec() {
+    mkt::csv::MappedReader reader ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv");
+    
+    if (!reader) {
+        std::cerr << strerror(errno);
+        return;
+    }
+    
+    decltype(reader)::Values values;
+    mkt::equity::Move move;
+    std::vector<mkt::equity::Move> moves;
+    mkt::equity::TickEncoder encoder (1024);
+    
+    while (reader.read_next_line(values)) {
+        if (move.from(values)) {
+            moves.push_back(move);
+            encoder.append(move);
+        }
     }
+    
+    auto bytes = encoder.finish();
+    mkt::equity::TickDecoder decoder (bytes);
+    assert (decoder && decoder.size() == moves.size());
+    
+    // straight to the block of the last quote
+    auto block = decoder.find(moves.back().event.time);
+    mkt::equity::tick_codec::Columns columns;
+    assert (decoder.decode(block, columns));
+    assert (columns.ask_prices.back() == moves.back().ask.price.ticks());
+    assert (decoder.string(columns.market_makers.back()) == moves.back().market.market_maker);
+    
+    std::cerr << moves.size() << " quotes in " << bytes.size() << " bytes" << std::endl;
+    
+    // a row without an exchange code is rejected like any other bad value
+    std::vector<std::string> row { "MarketMaker", "AAPL", "20190806-185959.999-0500", "", "XGWD", "20190806-150007-0500", "188.69", "0", "0", "20190806-150007-0500", "204.42", "0", "0" };
+    bool rejected = false;
+    try {
+        move.from(row);
+    } catch (const std::invalid_argument &) {
+        rejected = true;
+    }
+    assert (rejected);
+}
+
+void test_move_batch() {
+    mkt::csv::MappedReader reader ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv");
+    
+    if (!reader) {
+        std::cerr << strerror(errno);
+        return;
+    }
+    
+    mkt::equity::MoveBatch batch;
+    batch.append(reader);
+    assert (!batch.empty() && batch.string(batch.symbols[0]) == "AAPL");
+    
+    // the same rows back out of the compressed encoding
+    mkt::equity::TickEncoder encoder (1024);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        encoder.append(batch.move(i));
+    }
+    auto bytes = encoder.finish();
+    mkt::equity::MoveBatch decoded;
+    assert (decoded.append(mkt::equity::TickDecoder(bytes)) && decoded.size() == batch.size());
+    assert (decoded.ask_prices.back() == batch.ask_prices.back());
+    assert (decoded.string(decoded.market_makers.back()) == batch.string(batch.market_makers.back()));
+    
+    auto spreads = mkt::equity::move_batch::spreads(batch);
+    assert (spreads.size() == batch.size() && reinterpret_cast<uintptr_t>(spreads.data()) % 64 == 0);
+    
+    auto candles = mkt::equity::move_batch::bid_candles(batch, std::chrono::minutes(1));
+    std::cerr << batch.size() << " quotes, average spread " << mkt::equity::move_batch::mean_spread(batch)
+              << ", bid vwap " << mkt::equity::move_batch::bid_vwap(batch)
+              << ", " << candles.size() << " bid candles, first " << candles.front().second << std::endl;
+}
+
+void test_symbol_table() {
+    auto & symbols = mkt::util::SymbolTable::global();
+    
+    // every thread sees the same id for a string, whoever added it first
+    std::vector<std::thread> threads;
+    std::vector<std::vector<mkt::util::SymbolId>> ids (4);
+    for (size_t t = 0; t < ids.size(); ++t) {
+        threads.emplace_back([&symbols, &ids, t] {
+            for (int i = 0; i < 10000; ++i) {
+                ids[t].push_back(symbols.intern("SYM" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto & thread : threads) {
+        thread.join();
+    }
+    for (auto & other : ids) {
+        assert (other == ids.front());
+    }
+    assert (symbols.view(ids.front()[42]) == "SYM42" && symbols.find("SYM42") == ids.front()[42]);
+    
+    mkt::csv::ParallelInterpreter<mkt::equity::InternedMove> csv ("/Users/blagovest/Projects/Market/Market/data/apple-price-level-book.csv", 4, 64 << 10);
+    
+    if (!csv) {
+        std::cerr << strerror(errno);
+        return;
+    }
+    
+    auto aapl = symbols.intern("AAPL");
+    size_t rows = 0;
+    
+    csv.for_each([&] (const mkt::equity::InternedMove & row) {
+        assert (row.event.symbol == aapl);
+        ++rows;
+    });
+    
+    std::cerr << rows << " quotes, " << symbols.size() << " strings interned" << std::endl;
 }
 
 void test_random_walk() {
@@ -99,10 +626,120 @@ void test_fix_parser() {
     using String = std::string_view;
     mkt::fix::Parser<mkt::fix::MapBasedStoragePolicy<String>, String> map_parser (message);
     mkt::fix::Parser<mkt::fix::SequenceBasedStoragePolicy<String>, String> seq_parser (message);
+    mkt::fix::Parser<mkt::fix::IndexedStoragePolicy<String>, String> indexed_parser (message);
     assert (map_parser.length() == seq_parser.length());
+    assert (indexed_parser.fields().get(mkt::fix::Tag::MsgType) == "A");
+    assert (indexed_parser.fields().get(108) == "30");
+    assert (!indexed_parser.fields().has(55));
+    assert (mkt::fix::find("MsgType") == &mkt::fix::Tag::MsgType && !mkt::fix::find(101));
     std::cerr << "length: " << map_parser.length() << " checksum: " << static_cast<int>(map_parser.checksum()) << std::endl;
 }
 
+void test_fix_views() {
+    std::string message =
+     "8=FIX.4.2|9=145|35=D|49=CLIENT|56=BROKER|34=215|52=20201215-18:15:16.123|11=ORDER-1|55=AAPL|54=1|38=100|40=2|44=121.7800|59=0|60=20201215-18:15:16.120|10=000|";
+    std::replace(message.begin(), message.end(), '|', static_cast<char>(0x1));
+    
+    using String = std::string_view;
+    mkt::fix::Parser<mkt::fix::IndexedStoragePolicy<String>, String> parser (message);
+    mkt::fix::NewOrderSingleView order (parser.fields());
+    
+    assert (order.msg_type() == order.msg_type_value);
+    assert (order.order_qty() == 100 && order.side() == '1' && order.msg_seq_num() == 215);
+    assert (order.price() == mkt::fix::Price::parse("121.78") && !order.stop_px());
+    std::cerr << order.symbol().value() << " " << *order.order_qty() << "@" << *order.price() << " at " << order.sending_time()->time_since_epoch().count() << std::endl;
+}
+
+void test_fix_encoder() {
+    mkt::fix::Fragment session;
+    session.field(35, "D").field(49, "CLIENT").field(56, "BROKER");
+    
+    char buffer[256];
+    mkt::fix::Encoder encoder (buffer, sizeof(buffer));
+    auto message = encoder.append(session).field(34, 216).field(11, "ORDER-2").field(55, "AAPL").field(54, '2').field(38, 50).field(40, '2').field(44, mkt::fix::Price::parse("121.9")).finish();
+    
+    mkt::fix::MessageBatch batch;
+    mkt::fix::parse_batch(message, batch);
+    assert (batch.size() == 1 && batch.statuses[0] == mkt::fix::MessageBatch::OK);
+    
+    std::string printable (message);
+    std::replace(printable.begin(), printable.end(), static_cast<char>(0x1), '|');
+    std::cerr << printable << std::endl;
+}
+
+void test_fix_framer() {
+    std::string stream =
+     "8=FIX.4.2|9=65|35=A|49=SERVER|56=CLIENT|34=177|52=20090107-18:15:16|98=0|108=30|10=062|"
+     "8=FIX.4.2|9=49|35=5|34=1|49=ARCA|52=20150916-04:14:05.306|56=TW|10=157|";
+    std::replace(stream.begin(), stream.end(), '|', static_cast<char>(0x1));
+    
+    mkt::fix::Framer framer;
+    std::string_view message;
+    int count = 0;
+    
+    // as if it came in 10 bytes per read
+    for (size_t i = 0; i < stream.size(); i += 10) {
+        framer.feed(stream.data() + i, std::min<size_t>(10, stream.size() - i));
+        while (framer.next(message)) {
+            mkt::fix::Parser<mkt::fix::IndexedStoragePolicy<std::string_view>, std::string_view> parser (message);
+            std::cerr << "message " << ++count << ": " << *parser.fields().get(mkt::fix::Tag::MsgType) << std::endl;
+        }
+    }
+    
+    assert (count == 2 && !framer.pending());
+}
+
+void test_fix_batch() {
+    std::string log =
+     "8=FIX.4.2|9=65|35=A|49=SERVER|56=CLIENT|34=177|52=20090107-18:15:16|98=0|108=30|10=062|\n"
+     "8=FIX.4.2|9=49|35=5|34=1|49=ARCA|52=20150916-04:14:05.306|56=TW|10=158|\n"
+     "8=FIX.4.2|9=48|35=5|34=1|49=ARCA|52=20150916-04:14:05.306|56=TW|10=157|\n";
+    std::replace(log.begin(), log.end(), '|', static_cast<char>(0x1));
+    
+    mkt::fix::MessageBatch batch;
+    mkt::fix::parse_batch(log, batch);
+    
+    assert (batch.size() == 3);
+    assert (batch.statuses[0] == mkt::fix::MessageBatch::OK && batch.msg_types[0] == "A");
+    assert (batch.statuses[1] == mkt::fix::MessageBatch::BAD_CHECKSUM);
+    assert (batch.statuses[2] == mkt::fix::MessageBatch::BAD_BODY_LENGTH);
+    std::cerr << "batch: " << batch.size() << " messages, " << batch.tags.size() << " fields" << std::endl;
+    
+    // a BodyLength past the end doesn't swallow the messages after it
+    auto oversized = log;
+    oversized.replace(oversized.find("9=65"), 4, "9=650");
+    mkt::fix::parse_batch(oversized, batch);
+    assert (batch.size() == 3 && batch.statuses[0] == mkt::fix::MessageBatch::BAD_BODY_LENGTH);
+    assert (batch.statuses[1] == mkt::fix::MessageBatch::BAD_CHECKSUM && batch.msg_types[1] == "5");
+    
+    // unless there are none, then it's a message cut short
+    mkt::fix::parse_batch(std::string_view(log).substr(0, log.size() - 20), batch);
+    assert (batch.size() == 3 && batch.statuses[2] == mkt::fix::MessageBatch::TRUNCATED);
+}
+
+void test_fix_groups() {
+    std::string message =
+     "8=FIX.4.4|9=0|35=W|49=EXCH|56=CLIENT|34=12|55=AAPL|268=3|"
+     "269=0|270=121.70|271=300|453=2|448=MM1|447=D|452=1|448=MM2|447=D|452=1|"
+     "269=0|270=121.69|271=500|"
+     "269=1|270=121.72|271=200|10=000|";
+    std::replace(message.begin(), message.end(), '|', static_cast<char>(0x1));
+    
+    using String = std::string_view;
+    mkt::fix::Parser<mkt::fix::GroupedStoragePolicy<String>, String> parser (message);
+    auto & fields = parser.fields();
+    auto entries = fields.group(268);
+    
+    assert (entries.size() == 3 && !fields.overflow());
+    assert (fields.get(55) == "AAPL" && !fields.group(146).size());
+    assert (entries[0].group(453).size() == 2 && entries[1].group(453).empty());
+    assert (entries[2].get(269) == "1" && entries[2].get(270) == "121.72");
+    
+    for (auto entry : entries) {
+        std::cerr << *entry.get(269) << " " << *entry.get(271) << "@" << *entry.get(270) << std::endl;
+    }
+}
+
 int main() {
     test_fix_parser();
 
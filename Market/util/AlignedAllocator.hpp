@@ -0,0 +1,57 @@
+//
+//  AlignedAllocator.hpp
+//  Market
+//
+//  Created by Blagovest on 23/12/20.
+//
+
+#ifndef Util_AlignedAllocator_hpp
+#define Util_AlignedAllocator_hpp
+
+#include <cstddef>
+#include <new>
+
+namespace mkt {
+namespace util {
+
+    template <typename T, size_t Alignment>
+    class AlignedAllocator;
+
+    // Standard allocator handing out blocks that start on an Alignment
+    // boundary, e.g. a cache line, so a vector's data lines up with whole
+    // SIMD loads and no line is shared with a neighbouring array.
+    template <typename T, size_t Alignment = 64>
+    class AlignedAllocator {
+        static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two no less than alignof(T)");
+    public:
+        using value_type = T;
+        
+        template <typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+        
+        constexpr AlignedAllocator() noexcept = default;
+        
+        template <typename U>
+        constexpr AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+        
+        T * allocate(size_t n) {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+        
+        void deallocate(T * block, size_t) noexcept {
+            ::operator delete(block, std::align_val_t(Alignment));
+        }
+        
+        template <typename U>
+        constexpr bool operator == (const AlignedAllocator<U, Alignment> &) const noexcept { return true; }
+        
+        template <typename U>
+        constexpr bool operator != (const AlignedAllocator<U, Alignment> &) const noexcept { return false; }
+    };
+
+}
+}
+
+#endif /* AlignedAllocator_hpp */
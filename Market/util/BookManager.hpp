@@ -0,0 +1,260 @@
+//
+//  BookManager.hpp
+//  Market
+//
+//  Created by Blagovest on 08/12/20.
+//
+
+#ifndef Util_BookManager_hpp
+#define Util_BookManager_hpp
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "SpscQueue.hpp"
+#include "SymbolTable.hpp"
+
+namespace mkt {
+namespace util {
+
+    template <typename Order>
+    struct BookEvent;
+
+    template <typename Price>
+    struct Quote;
+
+    // Owns one Book per symbol and shards the symbols over worker threads,
+    // each applying its books' events in arrival order; a symbol always
+    // lives on the same shard, so books are never shared between threads
+    template <typename Book, size_t QueueCapacity = 1 << 16>
+    class BookManager;
+
+    template <typename Order>
+    struct BookEvent {
+        enum Type: uint8_t {
+            BID, ASK, CANCEL, REDUCE, REPLACE
+        };
+
+        SymbolId symbol;
+        Type type;
+        // cancel/reduce/replace find the resting order by order_id(order)
+        // and take the new quantity (and price) from it
+        Order order;
+    };
+
+    template <typename Price>
+    struct Quote {
+        std::optional<Price> bid;
+        std::optional<Price> ask;
+    };
+
+    template <typename Book, size_t QueueCapacity>
+    class BookManager {
+        using Order = typename Book::order_t;
+        using Price = decltype(std::declval<Order>().price());
+        using Event = BookEvent<Order>;
+
+        // written by the owning shard only, read by anyone: a seqlock,
+        // odd versions mean a write is in progress
+        struct alignas(64) TopOfBook {
+            std::atomic<uint64_t> version;
+            std::atomic<Price> bid, ask;
+            std::atomic<bool> has_bid, has_ask;
+        };
+
+        struct Shard {
+            SpscQueue<Event, QueueCapacity> queue;
+            std::atomic<uint64_t> processed;
+            uint64_t routed;
+            std::thread thread;
+        };
+
+        // only add() interns, so ids are dense and index books
+        SymbolTable symbols;
+        std::vector<std::unique_ptr<Book>> books;
+        std::unique_ptr<TopOfBook[]> tops;
+
+        std::vector<std::unique_ptr<Shard>> shards;
+        std::atomic<bool> running;
+
+        void apply(const Event & event) {
+            auto & book = *books[event.symbol];
+            auto id = order_id<Order>()(event.order);
+
+            switch (event.type) {
+                case Event::BID: book.bid(event.order); break;
+                case Event::ASK: book.ask(event.order); break;
+                case Event::CANCEL: book.cancel(id); break;
+                case Event::REDUCE: book.reduce(id, event.order.quantity()); break;
+                case Event::REPLACE: book.replace(id, event.order.quantity(), event.order.price()); break;
+            }
+
+            publish(event.symbol, book);
+        }
+
+        void publish(SymbolId symbol, const Book & book) {
+            auto & top = tops[symbol];
+            auto bid = book.best_bid();
+            auto ask = book.best_ask();
+            auto version = top.version.load(std::memory_order_relaxed);
+
+            top.version.store(version + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            top.has_bid.store(bid.has_value(), std::memory_order_relaxed);
+            top.has_ask.store(ask.has_value(), std::memory_order_relaxed);
+            top.bid.store(bid.value_or(Price()), std::memory_order_relaxed);
+            top.ask.store(ask.value_or(Price()), std::memory_order_relaxed);
+            top.version.store(version + 2, std::memory_order_release);
+        }
+
+        void work(Shard & shard) {
+            // keep going until stopped and everything routed so far is applied
+            while (true) {
+                auto count = shard.queue.drain([this] (const Event & event) { apply(event); });
+
+                if (count) {
+                    shard.processed.fetch_add(count, std::memory_order_release);
+                } else if (!running.load(std::memory_order_acquire)) {
+                    // whatever was routed before stop() is visible now,
+                    // even if it landed after the drain above
+                    count = shard.queue.drain([this] (const Event & event) { apply(event); });
+                    if (!count) {
+                        break;
+                    }
+                    shard.processed.fetch_add(count, std::memory_order_release);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    public:
+        BookManager(size_t shard_count = std::max(1u, std::thread::hardware_concurrency())): symbols(), books(), tops(), shards(), running(false) {
+            for (size_t i = 0; i < shard_count; ++i) {
+                shards.push_back(std::make_unique<Shard>());
+            }
+        }
+
+        BookManager(const BookManager & manager) = delete;
+
+        ~BookManager() {
+            stop();
+        }
+
+        // symbols can only be added before start(), since the
+        // shards index the books without any locking
+        template <typename... Args>
+        SymbolId add(std::string_view symbol, Args &&... args) {
+            if (auto id = symbols.find(symbol)) {
+                return *id;
+            }
+
+            // the book first, so a constructor (or push_back) that throws
+            // doesn't leave the symbol an id with no book behind it
+            auto book = std::make_unique<Book>(std::forward<Args>(args)...);
+            books.reserve(books.size() + 1);
+            auto id = symbols.intern(symbol);
+            books.push_back(std::move(book));
+            return id;
+        }
+
+        // lock free, callable from any thread
+        std::optional<SymbolId> id(std::string_view symbol) const {
+            return symbols.find(symbol);
+        }
+
+        std::string_view symbol(SymbolId id) const {
+            return symbols.view(id);
+        }
+
+        size_t size() const {
+            return books.size();
+        }
+
+        // only safe to look at while nothing is in flight, i.e. after flush() or stop()
+        const Book & book(SymbolId id) const {
+            return *books[id];
+        }
+
+        void start() {
+            tops = std::make_unique<TopOfBook[]>(books.size());
+            running.store(true, std::memory_order_release);
+
+            for (auto & shard : shards) {
+                shard->thread = std::thread([this, target = shard.get()] () { work(*target); });
+            }
+        }
+
+        // applies whatever was already routed, then joins the shards
+        void stop() {
+            running.store(false, std::memory_order_release);
+
+            for (auto & shard : shards) {
+                if (shard->thread.joinable()) {
+                    shard->thread.join();
+                }
+            }
+        }
+
+        // must always be called from the same (single producer) thread;
+        // spins while the symbol's shard queue is full
+        void route(const Event & event) {
+            auto & shard = *shards[event.symbol % shards.size()];
+
+            while (!shard.queue.try_push(event)) {
+                std::this_thread::yield();
+            }
+
+            ++shard.routed;
+        }
+
+        // producer only: waits until every routed event has been applied
+        void flush() const {
+            for (auto & shard : shards) {
+                while (shard->processed.load(std::memory_order_acquire) != shard->routed) {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        // consistent best bid/ask of one book, as of its last applied
+        // event; callable from any thread once started
+        Quote<Price> top(SymbolId symbol) const {
+            auto & top = tops[symbol];
+            Quote<Price> quote;
+            uint64_t before, after;
+
+            do {
+                before = top.version.load(std::memory_order_acquire);
+                auto has_bid = top.has_bid.load(std::memory_order_relaxed);
+                auto has_ask = top.has_ask.load(std::memory_order_relaxed);
+                auto bid = top.bid.load(std::memory_order_relaxed);
+                auto ask = top.ask.load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                after = top.version.load(std::memory_order_relaxed);
+
+                quote.bid = has_bid ? std::optional(bid) : std::nullopt;
+                quote.ask = has_ask ? std::optional(ask) : std::nullopt;
+            } while (before != after || (before & 1));
+
+            return quote;
+        }
+
+        // calls consumer(symbol id, quote) for every book
+        template <typename Consumer>
+        void for_each_top(Consumer && consumer) const {
+            for (SymbolId symbol = 0; symbol < books.size(); ++symbol) {
+                consumer(symbol, top(symbol));
+            }
+        }
+    };
+
+}
+}
+
+#endif /* BookManager_hpp */
@@ -10,6 +10,8 @@
 
 #include <iostream>
 
+#include "FixedPrice.hpp"
+
 namespace mkt {
 namespace util {
     class LowPriceEvaluationStrategy;
@@ -100,7 +102,11 @@ namespace util {
     public:
         template <typename CandleStick>
         auto operator() (const CandleStick & candle_stick) const {
-            return 0.5 * candle_stick.open() + 0.5 * candle_stick.close();
+            if constexpr (is_fixed_price_v<decltype(candle_stick.open())>) {
+                return (candle_stick.open() + candle_stick.close()) / 2;
+            } else {
+                return 0.5 * candle_stick.open() + 0.5 * candle_stick.close();
+            }
         }
     };
 
@@ -108,7 +114,11 @@ namespace util {
     public:
         template <typename CandleStick>
         auto operator() (const CandleStick & candle_stick) const {
-            return 0.5 * candle_stick.low() + 0.5 * candle_stick.high();
+            if constexpr (is_fixed_price_v<decltype(candle_stick.low())>) {
+                return (candle_stick.low() + candle_stick.high()) / 2;
+            } else {
+                return 0.5 * candle_stick.low() + 0.5 * candle_stick.high();
+            }
         }
     };
 
@@ -0,0 +1,46 @@
+//
+//  Cpu.hpp
+//  Market
+//
+//  Created by Blagovest on 19/12/20.
+//
+
+#ifndef Util_Cpu_hpp
+#define Util_Cpu_hpp
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MKT_X86 1
+#endif
+
+namespace mkt {
+namespace util {
+
+    // instruction sets the SIMD scanners have kernels for
+    enum class Isa {
+        SCALAR, SSE2, AVX2
+    };
+    
+    inline Isa detect() noexcept {
+#ifdef MKT_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return Isa::AVX2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return Isa::SSE2;
+        }
+#endif
+        return Isa::SCALAR;
+    }
+    
+    // the best this CPU runs, checked once
+    inline Isa isa() noexcept {
+        static const Isa detected = detect();
+        return detected;
+    }
+
+}
+}
+
+#endif /* Cpu_hpp */
@@ -0,0 +1,269 @@
+//
+//  FixedPrice.hpp
+//  Market
+//
+//  Created by Blagovest on 10/12/20.
+//
+
+#ifndef Util_FixedPrice_hpp
+#define Util_FixedPrice_hpp
+
+#include <charconv>
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace mkt {
+namespace util {
+
+    // A decimal price held as an integer number of ticks of 10^-Decimals,
+    // so comparisons are exact and volume() is a single integer multiply
+    template <unsigned Decimals, typename Rep = int64_t>
+    class FixedPrice;
+
+    template <typename Price>
+    struct is_fixed_price: std::false_type {};
+
+    template <unsigned Decimals, typename Rep>
+    struct is_fixed_price<FixedPrice<Decimals, Rep>>: std::true_type {};
+
+    template <typename Price>
+    inline constexpr bool is_fixed_price_v = is_fixed_price<std::remove_cv_t<Price>>::value;
+
+    template <unsigned Decimals, typename Rep>
+    class FixedPrice {
+        static_assert(std::is_integral_v<Rep> && std::is_signed_v<Rep>, "Rep must be a signed integer");
+
+        static constexpr Rep power(unsigned n) {
+            return n ? 10 * power(n - 1) : 1;
+        }
+    public:
+        static constexpr unsigned decimals = Decimals;
+        static constexpr Rep ticks_per_unit = power(Decimals);
+
+        static_assert(Decimals < std::numeric_limits<Rep>::digits10, "too many decimals for Rep");
+    private:
+        Rep _ticks;
+
+        // value * n / m rounded half away from zero, without overflowing in between
+        static constexpr Rep muldiv(Rep value, Rep n, Rep m) {
+            return divide(static_cast<__int128>(value) * n, m);
+        }
+
+        static constexpr Rep divide(__int128 product, Rep m) {
+            __int128 quotient = product / m;
+            __int128 remainder = product % m;
+
+            if (2 * (remainder < 0 ? -remainder : remainder) >= (m < 0 ? -static_cast<__int128>(m) : m)) {
+                quotient += (product < 0) != (m < 0) ? -1 : 1;
+            }
+
+            return static_cast<Rep>(quotient);
+        }
+    public:
+        constexpr FixedPrice(): _ticks() {}
+
+        template <typename Units, typename = std::enable_if_t<std::is_integral_v<Units>>>
+        constexpr explicit FixedPrice(Units units): _ticks(static_cast<Rep>(units) * ticks_per_unit) {}
+
+        // rounds to the nearest tick; only meant for the edges of the
+        // system, never for anything compared or summed afterwards
+        constexpr explicit FixedPrice(long double units): _ticks(static_cast<Rep>(units * ticks_per_unit + (units < 0 ? -0.5L : 0.5L))) {}
+        constexpr explicit FixedPrice(double units): FixedPrice(static_cast<long double>(units)) {}
+
+        static constexpr FixedPrice from_ticks(Rep ticks) {
+            FixedPrice price;
+            price._ticks = ticks;
+            return price;
+        }
+
+        // throws std::invalid_argument like std::stold, see from_chars below
+        static FixedPrice parse(std::string_view value);
+
+        constexpr Rep ticks() const noexcept { return _ticks; }
+
+        template <typename Floating, typename = std::enable_if_t<std::is_floating_point_v<Floating>>>
+        constexpr explicit operator Floating() const noexcept {
+            return static_cast<Floating>(_ticks) / static_cast<Floating>(ticks_per_unit);
+        }
+
+        // this * n / m, rounded to the nearest tick
+        constexpr FixedPrice scale(Rep n, Rep m) const {
+            return from_ticks(muldiv(_ticks, n, m));
+        }
+
+        // (a * n + b * k) / m, rounded once rather than per term, e.g. a
+        // weighted mid that a.scale(n, m) + b.scale(k, m) could be a tick off
+        static constexpr FixedPrice blend(FixedPrice a, Rep n, FixedPrice b, Rep k, Rep m) {
+            return from_ticks(divide(static_cast<__int128>(a._ticks) * n + static_cast<__int128>(b._ticks) * k, m));
+        }
+
+        constexpr bool operator == (const FixedPrice & rhs) const = default;
+        constexpr auto operator <=> (const FixedPrice & rhs) const = default;
+
+        constexpr FixedPrice operator - () const { return from_ticks(-_ticks); }
+        constexpr FixedPrice & operator += (FixedPrice rhs) { _ticks += rhs._ticks; return *this; }
+        constexpr FixedPrice & operator -= (FixedPrice rhs) { _ticks -= rhs._ticks; return *this; }
+        constexpr friend FixedPrice operator + (FixedPrice lhs, FixedPrice rhs) { return lhs += rhs; }
+        constexpr friend FixedPrice operator - (FixedPrice lhs, FixedPrice rhs) { return lhs -= rhs; }
+
+        // price * quantity, e.g. an order's volume (notional) at the same precision
+        template <typename Quantity, typename = std::enable_if_t<std::is_integral_v<Quantity>>>
+        constexpr friend FixedPrice operator * (FixedPrice price, Quantity quantity) {
+            return from_ticks(price._ticks * static_cast<Rep>(quantity));
+        }
+
+        template <typename Quantity, typename = std::enable_if_t<std::is_integral_v<Quantity>>>
+        constexpr friend FixedPrice operator * (Quantity quantity, FixedPrice price) {
+            return price * quantity;
+        }
+
+        template <typename Quantity, typename = std::enable_if_t<std::is_integral_v<Quantity>>>
+        constexpr friend FixedPrice operator / (FixedPrice price, Quantity quantity) {
+            return price.scale(1, static_cast<Rep>(quantity));
+        }
+
+        constexpr explicit operator bool () const { return _ticks; }
+
+        friend std::ostream & operator << (std::ostream & out, FixedPrice price) {
+            char buffer[std::numeric_limits<Rep>::digits10 + 4];
+            auto [end, error] = to_chars(buffer, buffer + sizeof(buffer), price);
+            return out.write(buffer, end - buffer);
+        }
+    };
+
+    // parses [-]digits[.digits], rounding any digits past Decimals half away
+    // from zero; no exponents, no locale, no allocation
+    template <unsigned Decimals, typename Rep>
+    std::from_chars_result from_chars(const char * first, const char * last, FixedPrice<Decimals, Rep> & value) {
+        using Price = FixedPrice<Decimals, Rep>;
+        using Unsigned = std::make_unsigned_t<Rep>;
+
+        const Unsigned limit = std::numeric_limits<Rep>::max();
+        auto it = first;
+        bool negative = it != last && *it == '-';
+        it += negative;
+
+        Unsigned ticks = 0;
+        unsigned fraction = 0;
+        bool digits = false, overflow = false, dot = false, round_up = false;
+
+        for (; it != last; ++it) {
+            if (*it == '.' && !dot) {
+                dot = true;
+                continue;
+            }
+
+            unsigned digit = static_cast<unsigned char>(*it) - '0';
+
+            if (digit > 9) {
+                break;
+            }
+
+            digits = true;
+
+            if (dot && fraction >= Decimals) {
+                // only the first dropped digit decides the rounding
+                if (fraction++ == Decimals) {
+                    round_up = digit >= 5;
+                }
+                continue;
+            }
+
+            fraction += dot;
+            overflow |= ticks > (limit - digit) / 10;
+            ticks = ticks * 10 + digit;
+        }
+
+        if (!digits) {
+            return { first, std::errc::invalid_argument };
+        }
+
+        for (auto i = std::min(fraction, Decimals); i < Decimals; ++i) {
+            overflow |= ticks > limit / 10;
+            ticks *= 10;
+        }
+
+        ticks += round_up;
+
+        if (overflow || ticks > limit) {
+            return { it, std::errc::result_out_of_range };
+        }
+
+        value = Price::from_ticks(negative ? -static_cast<Rep>(ticks) : static_cast<Rep>(ticks));
+        return { it, std::errc() };
+    }
+
+    // always prints all Decimals digits, e.g. 188.6900
+    template <unsigned Decimals, typename Rep>
+    std::to_chars_result to_chars(char * first, char * last, FixedPrice<Decimals, Rep> value) {
+        using Price = FixedPrice<Decimals, Rep>;
+        using Unsigned = std::make_unsigned_t<Rep>;
+
+        auto ticks = value.ticks() < 0 ? Unsigned(0) - static_cast<Unsigned>(value.ticks()) : static_cast<Unsigned>(value.ticks());
+        auto units = ticks / Price::ticks_per_unit;
+        auto fraction = ticks % Price::ticks_per_unit;
+
+        if (value.ticks() < 0) {
+            if (first == last) {
+                return { last, std::errc::value_too_large };
+            }
+            *first++ = '-';
+        }
+
+        auto result = std::to_chars(first, last, units);
+
+        if (result.ec != std::errc() || !Decimals) {
+            return result;
+        }
+
+        if (last - result.ptr < static_cast<std::ptrdiff_t>(Decimals) + 1) {
+            return { last, std::errc::value_too_large };
+        }
+
+        *result.ptr = '.';
+
+        for (auto i = Decimals; i > 0; --i) {
+            result.ptr[i] = static_cast<char>('0' + fraction % 10);
+            fraction /= 10;
+        }
+
+        return { result.ptr + Decimals + 1, std::errc() };
+    }
+
+    template <unsigned Decimals, typename Rep>
+    FixedPrice<Decimals, Rep> FixedPrice<Decimals, Rep>::parse(std::string_view value) {
+        FixedPrice price;
+        auto [end, error] = from_chars(value.data(), value.data() + value.size(), price);
+
+        if (error == std::errc::invalid_argument) {
+            throw std::invalid_argument("bad price " + std::string(value));
+        } else if (error == std::errc::result_out_of_range) {
+            throw std::out_of_range("price out of range " + std::string(value));
+        }
+
+        return price;
+    }
+
+}
+}
+
+namespace std {
+
+template <unsigned Decimals, typename Rep>
+struct hash<mkt::util::FixedPrice<Decimals, Rep>> {
+    std::size_t operator()(const mkt::util::FixedPrice<Decimals, Rep> & price) const {
+        return std::hash<Rep>()(price.ticks());
+    }
+};
+
+}
+
+#endif /* FixedPrice_hpp */
@@ -23,6 +23,13 @@ namespace util {
         constexpr operator Type () const { return value; }
     };
 
+    // does nothing with whatever it's called with
+    class discard {
+    public:
+        template <typename... Rest>
+        constexpr void operator() (Rest &&...) const {}
+    };
+
     // FIXME: remove in favor of std::identity when supported
     class identity {
     public:
@@ -0,0 +1,86 @@
+//
+//  MappedFile.hpp
+//  Market
+//
+//  Created by Blagovest on 18/12/20.
+//
+
+#ifndef Util_MappedFile_hpp
+#define Util_MappedFile_hpp
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mkt {
+namespace util {
+
+    // A whole file mapped read-only. If it can't be opened or mapped the
+    // object is empty and false, and errno says why, like a failed
+    // std::ifstream; an empty file maps to nothing and is false too.
+    // SEQUENTIAL asks the kernel to read ahead aggressively and drop pages
+    // behind us, which is what one pass over a file wants.
+    class MappedFile {
+        const char * _data;
+        size_t _size;
+    public:
+        enum class Access { NORMAL, SEQUENTIAL, RANDOM };
+        
+        explicit MappedFile(const char * path, Access access = Access::SEQUENTIAL) noexcept: _data(nullptr), _size() {
+            int fd = ::open(path, O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            
+            struct stat st;
+            if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+                void * data = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data != MAP_FAILED) {
+                    _data = static_cast<const char *>(data);
+                    _size = static_cast<size_t>(st.st_size);
+                    advise(access);
+                }
+            }
+            
+            // the mapping outlives the descriptor
+            ::close(fd);
+        }
+        
+        MappedFile(MappedFile && other) noexcept: _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0)) {}
+        
+        MappedFile & operator = (MappedFile && other) noexcept {
+            std::swap(_data, other._data);
+            std::swap(_size, other._size);
+            return *this;
+        }
+        
+        MappedFile(const MappedFile &) = delete;
+        MappedFile & operator = (const MappedFile &) = delete;
+        
+        ~MappedFile() {
+            if (_data) {
+                ::munmap(const_cast<char *>(_data), _size);
+            }
+        }
+        
+        void advise(Access access) const noexcept {
+            if (_data) {
+                ::madvise(const_cast<char *>(_data), _size, access == Access::SEQUENTIAL ? MADV_SEQUENTIAL : access == Access::RANDOM ? MADV_RANDOM : MADV_NORMAL);
+            }
+        }
+        
+        const char * data() const noexcept { return _data; }
+        size_t size() const noexcept { return _size; }
+        std::string_view view() const noexcept { return std::string_view(_data, _size); }
+        explicit operator bool() const noexcept { return _data; }
+    };
+
+}
+}
+
+#endif /* MappedFile_hpp */
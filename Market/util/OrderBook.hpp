@@ -14,12 +14,26 @@
 #include <compare>
 #include <optional>
 #include <numeric>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+#include "Functors.hpp"
+#include "FixedPrice.hpp"
+#include "Pool.hpp"
 
 namespace mkt {
 namespace util {
     template <typename Order>
     struct order_id;
 
+    template <typename Order>
+    struct amend_order;
+
     template <typename Order>
     struct cheaper;
 
@@ -32,10 +46,42 @@ namespace util {
     template <typename Price, typename Quantity>
     class SimpleOrder;
 
+    template <typename Id, typename Price, typename Quantity>
+    class IdentifiedOrder;
+
     template <typename Order, typename Set = std::multiset<Order, cheaper<Order>>, template <typename> typename FillPolicy = BestPriceFillPolicy, typename OrderIdFunctor = order_id<Order>>
     class MultisetOrderDatabase;
 
-    template <typename Order, typename BidsDatabase, typename AsksDatabase, typename PriceEvaluationPolicy>
+    // keeps one FIFO queue per price level in a flat sorted vector,
+    // best level at the back; Compare orders prices (std::less<> for bids,
+    // std::greater<> for asks)
+    template <typename Order, typename Compare = std::less<>, template <typename> typename FillPolicy = BestPriceFillPolicy, typename OrderIdFunctor = order_id<Order>, typename Allocator = std::allocator<Order>>
+    class PriceLevelOrderDatabase;
+
+    // the databases with their nodes taken from a PoolAllocator's pool;
+    // given a capacity up front and warmed up (see OrderBook::warm), a book
+    // makes no calls to the global allocator until it holds more orders
+    // than that
+    template <typename Order, typename Compare = cheaper<Order>, size_t Capacity = 1 << 16, bool Prefault = false>
+    using PooledMultisetOrderDatabase = MultisetOrderDatabase<Order, std::multiset<Order, Compare, PoolAllocator<Order, Capacity, Prefault>>>;
+
+    template <typename Order, typename Compare = std::less<>, size_t Capacity = 1 << 16, bool Prefault = false>
+    using PooledPriceLevelOrderDatabase = PriceLevelOrderDatabase<Order, Compare, BestPriceFillPolicy, order_id<Order>, PoolAllocator<Order, Capacity, Prefault>>;
+
+    template <typename Id, typename Price, typename Quantity>
+    struct Trade;
+
+    enum class Side {
+        BID, ASK
+    };
+
+    // a non-owning range over price levels, best first
+    template <typename Iterator>
+    class LevelView;
+
+    // ExecutionSink is called with a Trade for every match, e.g. a
+    // RingBuffer that consumers drain in batches
+    template <typename Order, typename BidsDatabase, typename AsksDatabase, typename PriceEvaluationPolicy, typename ExecutionSink = discard>
     class OrderBook;
 
     // Price evaluation strategies
@@ -47,30 +93,152 @@ namespace util {
       * Actual Definitions
       */
 
-    template <typename Order, typename BidsDatabase, typename AsksDatabase, typename PriceEvaluationPolicy>
+    template <typename Id, typename Price, typename Quantity>
+    struct Trade {
+        Id aggressor_id;
+        Id passive_id;
+        Price price;
+        Quantity quantity;
+        uint64_t seq;
+    };
+
+    template <typename Iterator>
+    class LevelView {
+        Iterator _begin, _end;
+    public:
+        LevelView(Iterator begin, Iterator end): _begin(begin), _end(end) {}
+        
+        Iterator begin() const { return _begin; }
+        Iterator end() const { return _end; }
+        size_t size() const { return std::distance(_begin, _end); }
+        bool empty() const { return _begin == _end; }
+        decltype(auto) operator[] (size_t i) const { return _begin[i]; }
+    };
+
+    template <typename Order, typename BidsDatabase, typename AsksDatabase, typename PriceEvaluationPolicy, typename ExecutionSink>
     class OrderBook {
+        using OrderId = std::remove_cv_t<std::remove_reference_t<decltype(order_id<Order>()(std::declval<Order>()))>>;
+        using Price = decltype(std::declval<Order>().price());
+        using Quantity = decltype(std::declval<Order>().quantity());
+        
         BidsDatabase bids;
         AsksDatabase asks;
         
         PriceEvaluationPolicy price_evaluation_policy;
+        ExecutionSink execution_sink;
+        uint64_t sequence;
+        
+        // trades at the resting order's price
+        auto executor(const Order & aggressor) {
+            return [this, &aggressor] (const Order & resting, Quantity quantity) {
+                execution_sink(trade_t { order_id<Order>()(aggressor), order_id<Order>()(resting), resting.price(), quantity, ++sequence });
+            };
+        }
+        
+        // a quantity decrease at the same price is done in place and keeps
+        // time priority, anything else loses it and is matched again
+        template <typename Database, typename Id, typename Quantity, typename Price>
+        bool amend(Database & database, const Id & id, Quantity quantity, Price price, void (OrderBook::*submit)(const Order &)) {
+            auto resting = database.find(id);
+            
+            if (!resting) {
+                return false;
+            }
+            
+            if (price == resting->price() && quantity <= resting->quantity()) {
+                return database.reduce(id, resting->quantity() - quantity);
+            }
+            
+            auto order = amend_order<Order>()(*resting, quantity, price);
+            database.cancel(id);
+            (this->*submit)(order);
+            return true;
+        }
     public:
-        OrderBook(PriceEvaluationPolicy price_evaluation_policy = PriceEvaluationPolicy {}): bids(), asks(), price_evaluation_policy(price_evaluation_policy) {}
+        using order_t = Order;
+        using trade_t = Trade<OrderId, Price, Quantity>;
+        
+        OrderBook(PriceEvaluationPolicy price_evaluation_policy = PriceEvaluationPolicy {}): bids(), asks(), price_evaluation_policy(price_evaluation_policy), execution_sink(), sequence() {}
+        
+        // piecewise like std::pair: the tuples are the bids' and asks'
+        // database constructor arguments, e.g. order id functor, capacity
+        // and allocator
+        template <typename... BidsArgs, typename... AsksArgs>
+        OrderBook(std::piecewise_construct_t, std::tuple<BidsArgs...> bids_args, std::tuple<AsksArgs...> asks_args, PriceEvaluationPolicy price_evaluation_policy = PriceEvaluationPolicy {}):
+            bids(std::make_from_tuple<BidsDatabase>(std::move(bids_args))), asks(std::make_from_tuple<AsksDatabase>(std::move(asks_args))), price_evaluation_policy(price_evaluation_policy), execution_sink(), sequence() {}
         
         // add only the unfilled part of each order
         void bid(const Order & bid) {
-            auto remaining = asks.fill(bid);
+            auto remaining = asks.fill(bid, executor(bid));
             if (remaining) {
-                bids.add(Order(bid.price(), remaining));
+                bids.add(amend_order<Order>()(bid, remaining));
             }
         }
         
         void ask(const Order & ask) {
-            auto remaining = bids.fill(ask);
+            auto remaining = bids.fill(ask, executor(ask));
             if (remaining) {
-                asks.add(Order(ask.price(), remaining));
+                asks.add(amend_order<Order>()(ask, remaining));
             }
         }
         
+        // resting orders are looked up by order_id, so these need
+        // an Order with a natural id (see IdentifiedOrder)
+        template <typename Id>
+        bool cancel(const Id & id) {
+            return bids.cancel(id) || asks.cancel(id);
+        }
+        
+        // takes quantity off a resting order, keeping its time priority
+        template <typename Id, typename Quantity>
+        bool reduce(const Id & id, Quantity quantity) {
+            return bids.reduce(id, quantity) || asks.reduce(id, quantity);
+        }
+        
+        template <typename Id, typename Quantity, typename Price>
+        bool replace(const Id & id, Quantity quantity, Price price) {
+            return amend(bids, id, quantity, price, &OrderBook::bid) || amend(asks, id, quantity, price, &OrderBook::ask);
+        }
+        
+        // adds and removes order on each side, outside any matching, so the
+        // nodes of every container are carved out of their pools (and
+        // prefaulted) now instead of by the first real order; only meant
+        // for an empty book
+        void warm(const Order & order) {
+            bids.warm(order);
+            asks.warm(order);
+        }
+        
+        ExecutionSink & executions() {
+            return execution_sink;
+        }
+        
+        // top n levels of each side, aggregated (see PriceLevelOrderDatabase::depth)
+        auto depth(size_t n) const {
+            return std::pair(bids.depth(n), asks.depth(n));
+        }
+        
+        void track_changes(bool enabled = true) {
+            bids.track_changes(enabled);
+            asks.track_changes(enabled);
+        }
+        
+        // calls consumer(side, price, quantity) for every level that changed
+        // since the last call; a quantity of zero means the level is gone
+        template <typename Consumer>
+        void changes(Consumer && consumer) {
+            bids.changes([&consumer] (auto price, auto quantity) { consumer(Side::BID, price, quantity); });
+            asks.changes([&consumer] (auto price, auto quantity) { consumer(Side::ASK, price, quantity); });
+        }
+        
+        auto best_bid() const {
+            return bids.safe_price();
+        }
+        
+        auto best_ask() const {
+            return asks.safe_price();
+        }
+        
         auto price() const {
             return price_evaluation_policy(*this);
         }
@@ -97,6 +265,18 @@ namespace util {
         const Order & operator() (const Order & order) const { return order; }
     };
 
+    // copies an order with a new quantity (and price), keeping
+    // anything else it carries; specialize it for orders that
+    // can't be built from just a price and a quantity
+    template <typename Order>
+    struct amend_order {
+        template <typename Quantity>
+        Order operator() (const Order & order, Quantity quantity) const { return Order(order.price(), quantity); }
+        
+        template <typename Quantity, typename Price>
+        Order operator() (const Order & order, Quantity quantity, Price price) const { return Order(price, quantity); }
+    };
+
     template <typename Order>
     struct cheaper {
         auto operator() (const Order a, const Order b) const {
@@ -119,20 +299,23 @@ namespace util {
     public:
         BestPriceFillPolicy(OrderDatabase & order_database): order_database(order_database) {}
         
-        auto operator() (const Order & order) const {
+        // calls match(resting, quantity) for every resting order
+        // it trades against, before that order is updated
+        template <typename Match = discard>
+        auto operator() (const Order & order, Match && match = Match {}) const {
             auto quantity = order.quantity();
             
-            for (auto it = order_database.order_set.rbegin(); it != order_database.order_set.rend() && quantity > 0 && order_database.compare( order, *it); ) {
-                if (quantity < it->quantity()) {
-                    Order order = Order(it->price(), it->quantity() - quantity);
-                    order_database.put(order);
-                    quantity = 0;
+            while (quantity > 0 && !order_database.empty()) {
+                auto best = order_database.best();
+                
+                if (order_database.compare(*best, order)) {
                     break;
-                } else {
-                    quantity -= it->quantity();
                 }
                 
-                order_database.erase(*it++);
+                auto filled = std::min(quantity, best->quantity());
+                match(*best, filled);
+                order_database.take(best, filled);
+                quantity -= filled;
             }
             
             return quantity;
@@ -146,9 +329,12 @@ namespace util {
         using Iterator = typename Set::iterator;
         using Comparator = typename Set::value_compare;
         using Price = decltype(std::declval<Order>().price());
+        using Quantity = decltype(std::declval<Order>().quantity());
+        using Allocator = typename Set::allocator_type;
+        using LookupAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const OrderId, Iterator>>;
         
         Set order_set;
-        std::unordered_map<OrderId, Iterator> order_lookup;
+        std::unordered_map<OrderId, Iterator, std::hash<OrderId>, std::equal_to<OrderId>, LookupAllocator> order_lookup;
         
         Volume total_volume;
         OrderIdFunctor order_id_functor;
@@ -156,13 +342,48 @@ namespace util {
         
         Comparator compare;
         
-        void erase(const Order & order) {
-            // erase from lookup map
-            order_lookup.erase(order_id_functor(order));
-            // erase from price set
-            order_set.erase(order);
+        Iterator erase(Iterator iterator) {
+            // erase from lookup map, unless a duplicate id took over the entry
+            auto entry = order_lookup.find(order_id_functor(*iterator));
+            if (entry != order_lookup.end() && entry->second == iterator) {
+                order_lookup.erase(entry);
+            }
             // update total_volume
+            total_volume -= iterator->volume();
+            // erase from price set
+            return order_set.erase(iterator);
+        }
+        
+        // the oldest order at the best price
+        Iterator best() {
+            return order_set.lower_bound(*order_set.rbegin());
+        }
+        
+        // the set is ordered by price only (see cheaper, more_expensive),
+        // so a quantity change can be made in place without losing priority
+        void resize(Iterator iterator, Quantity quantity) {
+            auto & order = const_cast<Order &>(*iterator);
+            OrderId id = order_id_functor(order);
             total_volume -= order.volume();
+            order = amend_order<Order>()(order, quantity);
+            total_volume += order.volume();
+            
+            // an order that is its own id (see order_id) gets a new one
+            if (!(order_id_functor(order) == id)) {
+                auto entry = order_lookup.find(id);
+                if (entry != order_lookup.end() && entry->second == iterator) {
+                    order_lookup.erase(entry);
+                }
+                order_lookup[order_id_functor(order)] = iterator;
+            }
+        }
+        
+        void take(Iterator iterator, Quantity quantity) {
+            if (quantity < iterator->quantity()) {
+                resize(iterator, iterator->quantity() - quantity);
+            } else {
+                erase(iterator);
+            }
         }
         
         void put(const Order & order) {
@@ -174,15 +395,51 @@ namespace util {
             total_volume += order.volume();
         }
     public:
-        MultisetOrderDatabase(OrderIdFunctor order_id_functor = OrderIdFunctor {}): fill_policy(FillPolicy<MultisetOrderDatabase>(*this)), order_set(), total_volume(), order_id_functor(order_id_functor), compare(order_set.value_comp()) {}
+        // the allocator policy comes with the Set (e.g. a PoolAllocator) and is
+        // shared with the lookup map; capacity pre-sizes the lookup buckets
+        MultisetOrderDatabase(OrderIdFunctor order_id_functor = OrderIdFunctor {}, size_t capacity = 0, Allocator allocator = Allocator {}): fill_policy(FillPolicy<MultisetOrderDatabase>(*this)), order_set(typename Set::key_compare(), allocator), order_lookup(capacity, std::hash<OrderId>(), std::equal_to<OrderId>(), LookupAllocator(allocator)), total_volume(), order_id_functor(order_id_functor), compare(order_set.value_comp()) {}
         MultisetOrderDatabase(const MultisetOrderDatabase & order_database) = delete;
         
         void add(const Order & order) {
             put(order);
         }
         
-        auto fill(const Order & order) {
-            return fill_policy(order);
+        // see OrderBook::warm
+        void warm(const Order & order) {
+            put(order);
+            erase(order_lookup.find(order_id_functor(order))->second);
+        }
+        
+        template <typename... Match>
+        auto fill(const Order & order, Match &&... match) {
+            return fill_policy(order, std::forward<Match>(match)...);
+        }
+        
+        const Order * find(const OrderId & id) const {
+            auto entry = order_lookup.find(id);
+            return entry == order_lookup.end() ? nullptr : &*entry->second;
+        }
+        
+        bool cancel(const OrderId & id) {
+            auto entry = order_lookup.find(id);
+            
+            if (entry == order_lookup.end()) {
+                return false;
+            }
+            
+            erase(entry->second);
+            return true;
+        }
+        
+        bool reduce(const OrderId & id, Quantity quantity) {
+            auto entry = order_lookup.find(id);
+            
+            if (entry == order_lookup.end()) {
+                return false;
+            }
+            
+            take(entry->second, quantity);
+            return true;
         }
         
         size_t size() const {
@@ -194,11 +451,11 @@ namespace util {
         }
         
         auto price() const { // WARNING: Don't call this if empty - garbage
-            return order_set.empty() ? Price() : order_set.begin()->price();
+            return order_set.empty() ? Price() : order_set.rbegin()->price();
         }
         
         auto safe_price() const -> std::optional<decltype(price())> {
-            return order_set.empty() ? std::nullopt : order_set.begin()->price();
+            return order_set.empty() ? std::nullopt : std::optional(order_set.rbegin()->price());
         }
         
         auto volume() const {
@@ -208,6 +465,413 @@ namespace util {
         friend FillPolicy<MultisetOrderDatabase>;
     };
 
+    template <typename Order, typename Compare, template <typename> typename FillPolicy, typename OrderIdFunctor, typename Allocator>
+    class BestPriceFillPolicy<PriceLevelOrderDatabase<Order, Compare, FillPolicy, OrderIdFunctor, Allocator>> {
+        using OrderDatabase = PriceLevelOrderDatabase<Order, Compare, FillPolicy, OrderIdFunctor, Allocator>;
+        
+        OrderDatabase & order_database;
+    public:
+        BestPriceFillPolicy(OrderDatabase & order_database): order_database(order_database) {}
+        
+        // calls match(resting, quantity) for every resting order
+        // it trades against, before that order is updated
+        template <typename Match = discard>
+        auto operator() (const Order & order, Match && match = Match {}) const {
+            auto quantity = order.quantity();
+            
+            while (quantity > 0 && order_database.crosses(order.price())) {
+                auto & resting = order_database.front();
+                auto filled = std::min(quantity, resting.quantity());
+                match(resting, filled);
+                order_database.take(filled);
+                quantity -= filled;
+            }
+            
+            return quantity;
+        }
+    };
+
+    template <typename Order, typename Compare, template <typename> typename FillPolicy, typename OrderIdFunctor, typename Allocator>
+    class PriceLevelOrderDatabase {
+        using OrderId = std::remove_reference_t<decltype(std::declval<OrderIdFunctor>()(std::declval<Order>()))>;
+        using Volume = std::remove_reference_t<decltype(std::declval<Order>().volume())>;
+        using Price = decltype(std::declval<Order>().price());
+        using Quantity = decltype(std::declval<Order>().quantity());
+        using Index = std::uint32_t;
+        
+        template <typename T>
+        using Rebind = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+        
+        static constexpr Index npos = std::numeric_limits<Index>::max();
+        
+        // resting orders live in one contiguous pool, chained
+        // into per-level FIFO queues by index
+        struct Node {
+            Order order;
+            Index prev, next;
+        };
+        
+        struct Level {
+            Price price;
+            Quantity quantity;
+            Index head, tail;
+            bool dirty;
+        };
+        
+        // sorted by compare, so the best level is always at the back
+        std::vector<Level, Rebind<Level>> levels;
+        std::vector<Node, Rebind<Node>> nodes;
+        // prices of levels changed since the last changes() call, if tracked
+        std::vector<Price, Rebind<Price>> dirty;
+        bool tracking;
+        
+        // the order lookup: open addressing over node indices, keyed by the
+        // node's own order id, so a slot is just the index and its hash and
+        // nothing is allocated until the table doubles at half full
+        struct Slot {
+            Index index;
+            std::uint32_t hash;
+        };
+        
+        std::vector<Slot, Rebind<Slot>> slots;
+        size_t indexed;
+        Index free_head;
+        size_t count;
+        
+        Volume total_volume;
+        OrderIdFunctor order_id_functor;
+        FillPolicy<PriceLevelOrderDatabase> fill_policy;
+        
+        Compare compare;
+        
+        static size_t table_size(size_t capacity) {
+            size_t size = 16;
+            while (size < 2 * capacity) {
+                size *= 2;
+            }
+            return size;
+        }
+        
+        static std::uint32_t hash(const OrderId & id) {
+            return static_cast<std::uint32_t>(std::hash<OrderId>()(id));
+        }
+        
+        // the slot holding id, or the empty one it would go in
+        size_t probe(const OrderId & id, std::uint32_t hash) const {
+            auto mask = slots.size() - 1;
+            for (auto i = hash & mask; ; i = (i + 1) & mask) {
+                auto & slot = slots[i];
+                if (slot.index == npos || (slot.hash == hash && order_id_functor(nodes[slot.index].order) == id)) {
+                    return i;
+                }
+            }
+        }
+        
+        // the node holding id, npos if none
+        Index lookup(const OrderId & id) const {
+            return slots[probe(id, hash(id))].index;
+        }
+        
+        void grow() {
+            std::vector<Slot, Rebind<Slot>> grown (2 * slots.size(), Slot { npos, 0 }, slots.get_allocator());
+            auto mask = grown.size() - 1;
+            for (auto & slot : slots) {
+                if (slot.index != npos) {
+                    auto i = slot.hash & mask;
+                    while (grown[i].index != npos) {
+                        i = (i + 1) & mask;
+                    }
+                    grown[i] = slot;
+                }
+            }
+            slots.swap(grown);
+        }
+        
+        // makes the node's order findable by its id, in place of any
+        // other node with the same id
+        void index(Index index) {
+            if (2 * (indexed + 1) > slots.size()) {
+                grow();
+            }
+            
+            auto id = order_id_functor(nodes[index].order);
+            auto & slot = slots[probe(id, hash(id))];
+            indexed += slot.index == npos;
+            slot = Slot { index, hash(id) };
+        }
+        
+        // drops the node's slot, found from the hash of the id it was
+        // indexed by, unless another node with the same id took it over
+        void unindex(Index index, std::uint32_t hash) {
+            auto mask = slots.size() - 1;
+            auto i = hash & mask;
+            for (; slots[i].index != index; i = (i + 1) & mask) {
+                if (slots[i].index == npos) {
+                    return;
+                }
+            }
+            
+            // shift back whatever in the rest of the run may sit in the hole
+            for (auto j = (i + 1) & mask; slots[j].index != npos; j = (j + 1) & mask) {
+                if (((j - slots[j].hash) & mask) >= ((j - i) & mask)) {
+                    slots[i] = slots[j];
+                    i = j;
+                }
+            }
+            
+            slots[i].index = npos;
+            --indexed;
+        }
+        
+        Index allocate(const Order & order) {
+            if (free_head == npos) {
+                nodes.push_back(Node { order, npos, npos });
+                return static_cast<Index>(nodes.size() - 1);
+            }
+            
+            auto index = free_head;
+            free_head = nodes[index].next;
+            nodes[index] = Node { order, npos, npos };
+            return index;
+        }
+        
+        void release(Index index) {
+            nodes[index].next = free_head;
+            free_head = index;
+        }
+        
+        Level & level(Price price) {
+            // new prices usually arrive at (or near) the top of the book
+            if (levels.empty() || compare(levels.back().price, price)) {
+                return levels.emplace_back(Level { price, Quantity(), npos, npos, false });
+            }
+            
+            auto it = std::lower_bound(levels.begin(), levels.end(), price, [this] (const Level & level, const Price & price) {
+                return compare(level.price, price);
+            });
+            
+            if (compare(price, it->price)) {
+                it = levels.insert(it, Level { price, Quantity(), npos, npos, false });
+            }
+            
+            return *it;
+        }
+        
+        auto find_level(Price price) {
+            return std::lower_bound(levels.begin(), levels.end(), price, [this] (const Level & level, const Price & price) {
+                return compare(level.price, price);
+            });
+        }
+        
+        void touch(Level & level) {
+            if (tracking && !level.dirty) {
+                level.dirty = true;
+                dirty.push_back(level.price);
+            }
+        }
+        
+        bool crosses(Price price) const {
+            return !levels.empty() && !compare(levels.back().price, price);
+        }
+        
+        void resize(Node & node, Level & level, Quantity quantity) {
+            OrderId id = order_id_functor(node.order);
+            total_volume -= node.order.volume();
+            level.quantity -= node.order.quantity() - quantity;
+            touch(level);
+            node.order = amend_order<Order>()(node.order, quantity);
+            total_volume += node.order.volume();
+            
+            // an order that is its own id (see order_id) gets a new one
+            if (!(order_id_functor(node.order) == id)) {
+                auto index = static_cast<Index>(&node - nodes.data());
+                unindex(index, hash(id));
+                this->index(index);
+            }
+        }
+        
+        // unlinks a node from its level and drops the level once empty
+        template <typename LevelIterator>
+        void erase(Index index, LevelIterator level) {
+            auto & node = nodes[index];
+            
+            (node.prev == npos ? level->head : nodes[node.prev].next) = node.next;
+            (node.next == npos ? level->tail : nodes[node.next].prev) = node.prev;
+            
+            level->quantity -= node.order.quantity();
+            total_volume -= node.order.volume();
+            touch(*level);
+            
+            unindex(index, hash(order_id_functor(node.order)));
+            release(index);
+            --count;
+            
+            if (level->head == npos) {
+                levels.erase(level);
+            }
+        }
+        
+        // the oldest order at the best price
+        const Order & front() const {
+            return nodes[levels.back().head].order;
+        }
+        
+        // fills quantity (at most all of it) of the front order
+        void take(Quantity quantity) {
+            auto & best = levels.back();
+            auto & node = nodes[best.head];
+            
+            if (quantity < node.order.quantity()) {
+                resize(node, best, node.order.quantity() - quantity);
+            } else {
+                erase(best.head, std::prev(levels.end()));
+            }
+        }
+        
+        void put(const Order & order) {
+            auto & target = level(order.price());
+            auto index = allocate(order);
+            
+            if (target.tail == npos) {
+                target.head = index;
+            } else {
+                nodes[target.tail].next = index;
+                nodes[index].prev = target.tail;
+            }
+            
+            target.tail = index;
+            target.quantity += order.quantity();
+            touch(target);
+            this->index(index);
+            total_volume += order.volume();
+            ++count;
+        }
+    public:
+        // with capacity reserved up front nothing is allocated until the
+        // book outgrows capacity orders (or levels)
+        PriceLevelOrderDatabase(OrderIdFunctor order_id_functor = OrderIdFunctor {}, size_t capacity = 0, Allocator allocator = Allocator {}): levels(allocator), nodes(allocator), dirty(allocator), tracking(false), slots(table_size(capacity), Slot { npos, 0 }, allocator), indexed(), free_head(npos), count(), total_volume(), order_id_functor(order_id_functor), fill_policy(FillPolicy<PriceLevelOrderDatabase>(*this)), compare() {
+            levels.reserve(capacity);
+            nodes.reserve(capacity);
+        }
+        PriceLevelOrderDatabase(const PriceLevelOrderDatabase & order_database) = delete;
+        
+        void add(const Order & order) {
+            put(order);
+        }
+        
+        // see OrderBook::warm; tracked changes don't see it
+        void warm(const Order & order) {
+            auto tracked = tracking;
+            tracking = false;
+            put(order);
+            cancel(order_id_functor(order));
+            tracking = tracked;
+        }
+        
+        template <typename... Match>
+        auto fill(const Order & order, Match &&... match) {
+            return fill_policy(order, std::forward<Match>(match)...);
+        }
+        
+        const Order * find(const OrderId & id) const {
+            auto index = lookup(id);
+            return index == npos ? nullptr : &nodes[index].order;
+        }
+        
+        bool cancel(const OrderId & id) {
+            auto index = lookup(id);
+            
+            if (index == npos) {
+                return false;
+            }
+            
+            erase(index, find_level(nodes[index].order.price()));
+            return true;
+        }
+        
+        bool reduce(const OrderId & id, Quantity quantity) {
+            auto index = lookup(id);
+            
+            if (index == npos) {
+                return false;
+            }
+            
+            auto & node = nodes[index];
+            auto level = find_level(node.order.price());
+            
+            if (quantity >= node.order.quantity()) {
+                erase(index, level);
+            } else {
+                resize(node, *level, node.order.quantity() - quantity);
+            }
+            
+            return true;
+        }
+        
+        size_t size() const {
+            return count;
+        }
+        
+        bool empty() const {
+            return levels.empty();
+        }
+        
+        // the best n levels, best first, straight out of the level vector;
+        // each has a price and the total quantity resting at it
+        auto depth(size_t n) const {
+            auto begin = levels.rbegin();
+            return LevelView(begin, begin + std::min(n, levels.size()));
+        }
+        
+        // starts (or stops) tracking from a clean slate
+        void track_changes(bool enabled = true) {
+            for (auto & level : levels) {
+                level.dirty = false;
+            }
+            
+            dirty.clear();
+            tracking = enabled;
+        }
+        
+        // calls consumer(price, quantity) once for every level changed since
+        // the last call, with zero quantity for levels that are gone
+        template <typename Consumer>
+        void changes(Consumer && consumer) {
+            auto equal = [this] (const Price & a, const Price & b) { return !compare(a, b) && !compare(b, a); };
+            
+            // a level emptied and re-created in between is listed twice
+            std::sort(dirty.begin(), dirty.end(), compare);
+            dirty.erase(std::unique(dirty.begin(), dirty.end(), equal), dirty.end());
+            
+            for (auto price : dirty) {
+                auto it = find_level(price);
+                
+                if (it != levels.end() && equal(it->price, price)) {
+                    it->dirty = false;
+                    consumer(price, it->quantity);
+                } else {
+                    consumer(price, Quantity());
+                }
+            }
+            
+            dirty.clear();
+        }
+        
+        auto price() const { // WARNING: Don't call this if empty - garbage
+            return levels.empty() ? Price() : levels.back().price;
+        }
+        
+        auto safe_price() const -> std::optional<decltype(price())> {
+            return levels.empty() ? std::nullopt : std::optional(levels.back().price);
+        }
+        
+        auto volume() const {
+            return total_volume;
+        }
+        
+        friend FillPolicy<PriceLevelOrderDatabase>;
+    };
+
     template <typename Price, typename Quantity>
     class SimpleOrder {
         Price _price;
@@ -220,6 +884,30 @@ namespace util {
         auto volume() const { return _price * _quantity; }
         bool operator == (const SimpleOrder & rhs) const = default;
     };
+
+    template <typename Id, typename Price, typename Quantity>
+    class IdentifiedOrder: public SimpleOrder<Price, Quantity> {
+        Id _id;
+    public:
+        IdentifiedOrder(Id id, Price price, Quantity quantity): SimpleOrder<Price, Quantity>(price, quantity), _id(id) {}
+        IdentifiedOrder(const IdentifiedOrder & order) = default;
+        IdentifiedOrder & operator = (const IdentifiedOrder & order) = default;
+        Id id() const { return _id; }
+        bool operator == (const IdentifiedOrder & rhs) const = default;
+    };
+
+    template <typename Id, typename Price, typename Quantity>
+    struct order_id<IdentifiedOrder<Id, Price, Quantity>> {
+        Id operator() (const IdentifiedOrder<Id, Price, Quantity> & order) const { return order.id(); }
+    };
+
+    template <typename Id, typename Price, typename Quantity>
+    struct amend_order<IdentifiedOrder<Id, Price, Quantity>> {
+        using Order = IdentifiedOrder<Id, Price, Quantity>;
+        
+        Order operator() (const Order & order, Quantity quantity) const { return Order(order.id(), order.price(), quantity); }
+        Order operator() (const Order & order, Quantity quantity, Price price) const { return Order(order.id(), price, quantity); }
+    };
     
     template <long n, long m>
     class WeighedPriceEvaluationPolicy {
@@ -233,7 +921,13 @@ namespace util {
         
         template <typename OrderBook>
         auto operator() (const OrderBook & order_book) const {
-            return alpha * order_book.bids.price() + beta * order_book.asks.price();
+            // stay in whole ticks rather than going through long double
+            if constexpr (is_fixed_price_v<decltype(order_book.bids.price())>) {
+                using Price = decltype(order_book.bids.price());
+                return Price::blend(order_book.bids.price(), n, order_book.asks.price(), m - n, m);
+            } else {
+                return alpha * order_book.bids.price() + beta * order_book.asks.price();
+            }
         }
     };
 
@@ -248,9 +942,16 @@ namespace util {
             auto bid_volume = order_book.bids.volume();
             auto ask_volume = order_book.asks.volume();
             auto total_volume = bid_volume + ask_volume;
-            auto bid_weight = total_volume ? bid_volume / total_volume : 0;
-            auto ask_weight = total_volume ? ask_volume / total_volume : 0;
-            return bid_weight * order_book.bids.price() + ask_weight * order_book.asks.price();
+            
+            // volumes are fixed point too, so weigh by their tick counts
+            if constexpr (is_fixed_price_v<decltype(total_volume)>) {
+                using Price = decltype(order_book.bids.price());
+                return total_volume ? Price::blend(order_book.bids.price(), bid_volume.ticks(), order_book.asks.price(), ask_volume.ticks(), total_volume.ticks()) : Price();
+            } else {
+                auto bid_weight = total_volume ? bid_volume / total_volume : 0;
+                auto ask_weight = total_volume ? ask_volume / total_volume : 0;
+                return bid_weight * order_book.bids.price() + ask_weight * order_book.asks.price();
+            }
         }
     };
 }
@@ -0,0 +1,171 @@
+//
+//  Pool.hpp
+//  Market
+//
+//  Created by Blagovest on 05/12/20.
+//
+
+#ifndef Util_Pool_hpp
+#define Util_Pool_hpp
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace mkt {
+namespace util {
+
+    class Pool;
+
+    template <typename T, size_t Capacity = 1 << 16, bool Prefault = false>
+    class PoolAllocator;
+
+    // Fixed-capacity slabs of equally sized blocks, one per block size,
+    // recycled through intrusive free lists. A slab is carved out by
+    // reserve(), or else the first time its block size is requested; once
+    // it runs out, blocks come from the global allocator instead. Not
+    // thread safe.
+    class Pool {
+        struct Slab {
+            size_t size;
+            size_t align;
+            std::byte * begin;
+            std::byte * end;
+            std::byte * bump;
+            void * free_head;
+
+            bool owns(void * block) const {
+                return begin <= block && block < end;
+            }
+        };
+
+        size_t capacity;
+        bool prefault;
+        std::vector<Slab> slabs;
+
+        Slab & slab(size_t size, size_t align) {
+            // the free list is threaded through the blocks themselves
+            size = std::max(size, sizeof(void *));
+            size = (size + align - 1) / align * align;
+
+            for (auto & slab : slabs) {
+                if (slab.size == size && slab.align == align) {
+                    return slab;
+                }
+            }
+
+            auto begin = static_cast<std::byte *>(::operator new(size * capacity, std::align_val_t(align)));
+
+            if (prefault) {
+                // touch every page now rather than on the hot path
+                std::memset(begin, 0, size * capacity);
+            }
+
+            return slabs.emplace_back(Slab { size, align, begin, begin + size * capacity, begin, nullptr });
+        }
+    public:
+        Pool(size_t capacity, bool prefault = false): capacity(capacity), prefault(prefault), slabs() {}
+        Pool(const Pool & pool) = delete;
+
+        ~Pool() {
+            for (auto & slab : slabs) {
+                ::operator delete(slab.begin, std::align_val_t(slab.align));
+            }
+        }
+
+        // carves out (and prefaults) the slab for a block size now, rather
+        // than on its first allocation
+        void reserve(size_t size, size_t align) {
+            slab(size, align);
+        }
+
+        void * allocate(size_t size, size_t align) {
+            auto & from = slab(size, align);
+
+            if (from.free_head) {
+                auto block = from.free_head;
+                from.free_head = *static_cast<void **>(block);
+                return block;
+            }
+
+            if (from.bump != from.end) {
+                auto block = from.bump;
+                from.bump += from.size;
+                return block;
+            }
+
+            return ::operator new(size, std::align_val_t(align));
+        }
+
+        void deallocate(void * block, size_t size, size_t align) {
+            auto & from = slab(size, align);
+
+            if (from.owns(block)) {
+                *static_cast<void **>(block) = from.free_head;
+                from.free_head = block;
+            } else {
+                ::operator delete(block, std::align_val_t(align));
+            }
+        }
+    };
+
+    // Standard allocator over a shared Pool. Single objects (the nodes of
+    // std::multiset, std::unordered_map etc.) come from the pool, arrays
+    // (vectors, hash buckets) from the global allocator, so reserve those
+    // up front. Rebound copies share the pool they were made from.
+    template <typename T, size_t Capacity, bool Prefault>
+    class PoolAllocator {
+        std::shared_ptr<Pool> pool;
+
+        template <typename, size_t, bool>
+        friend class PoolAllocator;
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind {
+            using other = PoolAllocator<U, Capacity, Prefault>;
+        };
+
+        PoolAllocator(): pool(std::make_shared<Pool>(Capacity, Prefault)) {}
+        PoolAllocator(std::shared_ptr<Pool> pool): pool(std::move(pool)) {}
+
+        template <typename U>
+        PoolAllocator(const PoolAllocator<U, Capacity, Prefault> & other): pool(other.pool) {}
+
+        // the slab for U, e.g. a node type, see Pool::reserve
+        template <typename U = T>
+        void reserve() const {
+            pool->reserve(sizeof(U), alignof(U));
+        }
+
+        T * allocate(size_t n) {
+            if (n == 1) {
+                return static_cast<T *>(pool->allocate(sizeof(T), alignof(T)));
+            }
+
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T * block, size_t n) {
+            if (n == 1) {
+                pool->deallocate(block, sizeof(T), alignof(T));
+            } else {
+                std::allocator<T>().deallocate(block, n);
+            }
+        }
+
+        template <typename U>
+        bool operator == (const PoolAllocator<U, Capacity, Prefault> & rhs) const { return pool == rhs.pool; }
+
+        template <typename U>
+        bool operator != (const PoolAllocator<U, Capacity, Prefault> & rhs) const { return pool != rhs.pool; }
+    };
+
+}
+}
+
+#endif /* Pool_hpp */
@@ -0,0 +1,70 @@
+//
+//  RingBuffer.hpp
+//  Market
+//
+//  Created by Blagovest on 06/12/20.
+//
+
+#ifndef Util_RingBuffer_hpp
+#define Util_RingBuffer_hpp
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace mkt {
+namespace util {
+
+    template <typename T, size_t Capacity>
+    class RingBuffer;
+
+    // Fixed-size FIFO that never allocates. When the reader falls more
+    // than Capacity elements behind, the oldest ones are overwritten and
+    // counted in overruns(), so size it for the largest burst between
+    // two drains. Not thread safe.
+    template <typename T, size_t Capacity>
+    class RingBuffer {
+        static_assert(Capacity && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+        std::array<T, Capacity> data;
+        uint64_t head, tail;
+        uint64_t _overruns;
+    public:
+        RingBuffer(): data(), head(), tail(), _overruns() {}
+        RingBuffer(const RingBuffer & buffer) = delete;
+
+        void push(const T & value) {
+            data[tail++ & (Capacity - 1)] = value;
+
+            if (tail - head > Capacity) {
+                head = tail - Capacity;
+                ++_overruns;
+            }
+        }
+
+        void operator() (const T & value) {
+            push(value);
+        }
+
+        // hands every buffered element to consumer, oldest first,
+        // and returns how many there were
+        template <typename Consumer>
+        size_t drain(Consumer && consumer) {
+            auto count = tail - head;
+
+            while (head != tail) {
+                consumer(data[head++ & (Capacity - 1)]);
+            }
+
+            return count;
+        }
+
+        size_t size() const { return tail - head; }
+        bool empty() const { return tail == head; }
+        uint64_t overruns() const { return _overruns; }
+    };
+
+}
+}
+
+#endif /* RingBuffer_hpp */
@@ -0,0 +1,109 @@
+//
+//  SpscQueue.hpp
+//  Market
+//
+//  Created by Blagovest on 08/12/20.
+//
+
+#ifndef Util_SpscQueue_hpp
+#define Util_SpscQueue_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace mkt {
+namespace util {
+
+    template <typename T, size_t Capacity>
+    class SpscQueue;
+
+    // Bounded lock-free queue for exactly one producer and one consumer
+    // thread. Each side keeps a private copy of the other side's index and
+    // only reloads it when the queue looks full (or empty), so the shared
+    // cache lines are touched once per batch rather than once per element.
+    template <typename T, size_t Capacity>
+    class SpscQueue {
+        static_assert(Capacity && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of 2");
+
+        static constexpr size_t cache_line = 64;
+
+        // raw slots, so T needn't be default constructible
+        struct Slot {
+            alignas(T) std::byte bytes[sizeof(T)];
+        };
+
+        std::unique_ptr<Slot[]> data;
+
+        T & at(uint64_t position) {
+            return *std::launder(reinterpret_cast<T *>(data[position & (Capacity - 1)].bytes));
+        }
+
+        // consumer side
+        alignas(cache_line) std::atomic<uint64_t> head;
+        uint64_t cached_tail;
+
+        // producer side
+        alignas(cache_line) std::atomic<uint64_t> tail;
+        uint64_t cached_head;
+    public:
+        SpscQueue(): data(std::make_unique<Slot[]>(Capacity)), head(), cached_tail(), tail(), cached_head() {}
+        SpscQueue(const SpscQueue & queue) = delete;
+
+        ~SpscQueue() {
+            drain([] (T &) {});
+        }
+
+        // producer only
+        bool try_push(const T & value) {
+            auto position = tail.load(std::memory_order_relaxed);
+
+            if (position - cached_head == Capacity) {
+                cached_head = head.load(std::memory_order_acquire);
+                if (position - cached_head == Capacity) {
+                    return false;
+                }
+            }
+
+            new (data[position & (Capacity - 1)].bytes) T(value);
+            tail.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        // consumer only: hands up to max queued elements to consumer
+        // and returns how many there were
+        template <typename Consumer>
+        size_t drain(Consumer && consumer, size_t max = Capacity) {
+            auto position = head.load(std::memory_order_relaxed);
+
+            if (position == cached_tail) {
+                cached_tail = tail.load(std::memory_order_acquire);
+                if (position == cached_tail) {
+                    return 0;
+                }
+            }
+
+            auto count = std::min<uint64_t>(cached_tail - position, max);
+
+            for (uint64_t i = 0; i < count; ++i) {
+                auto & value = at(position + i);
+                consumer(value);
+                value.~T();
+            }
+
+            head.store(position + count, std::memory_order_release);
+            return count;
+        }
+
+        bool empty() const {
+            return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+        }
+    };
+
+}
+}
+
+#endif /* SpscQueue_hpp */
@@ -0,0 +1,209 @@
+//
+//  SymbolTable.hpp
+//  Market
+//
+//  Created by Blagovest on 24/12/20.
+//
+
+#ifndef Util_SymbolTable_hpp
+#define Util_SymbolTable_hpp
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace mkt {
+namespace util {
+
+    using SymbolId = uint32_t;
+
+    // Interns strings (symbols, market makers, flags...) to dense ids from
+    // 0, from any number of threads. Finding a string that's already there
+    // and view() take no lock, only adding a new one does. The bytes of an
+    // interned string never move, so its views live as long as the table;
+    // for global() that's the whole program.
+    class SymbolTable;
+
+    class SymbolTable {
+        struct Entry {
+            const char * data;
+            size_t size;
+            size_t hash;
+        };
+        
+        // A slot is 0 when empty, else the id + 1 in the low half and the
+        // top of the hash in the high half, to skip most string compares.
+        // Tables are replaced, never resized, once half full.
+        struct Table {
+            size_t mask;
+            std::unique_ptr<std::atomic<uint64_t>[]> slots;
+            
+            explicit Table(size_t capacity): mask(capacity - 1), slots(new std::atomic<uint64_t>[capacity]()) {}
+        };
+        
+        // Entries live in segments of 1024, 2048, 4096... so none moves
+        // when more are added; segment k starts at id (2^k - 1) * 1024.
+        static constexpr unsigned base_bits = 10;
+        static constexpr unsigned segment_count = 32 - base_bits;
+        static constexpr size_t capacity = ((size_t(1) << segment_count) - 1) << base_bits;
+        static constexpr size_t chunk_size = 64 << 10;
+        
+        std::atomic<Entry *> segments[segment_count];
+        std::atomic<Table *> table;
+        std::atomic<SymbolId> count;
+        
+        // writers only
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Table>> tables;     // outgrown ones too, readers may still be in them
+        std::vector<std::unique_ptr<char[]>> chunks;
+        char * bump;
+        size_t left;
+        
+        static std::pair<unsigned, size_t> locate(SymbolId id) noexcept {
+            auto n = (static_cast<uint64_t>(id) >> base_bits) + 1;
+            unsigned segment = 63 - __builtin_clzll(n);
+            return { segment, id - (((uint64_t(1) << segment) - 1) << base_bits) };
+        }
+        
+        // the top of a 64 bit hash, all of a 32 bit one
+        static uint64_t tag(size_t hash) noexcept {
+            auto wide = static_cast<uint64_t>(hash);
+            return sizeof(size_t) > 4 ? wide >> 32 << 32 : wide << 32;
+        }
+        
+        std::optional<SymbolId> find(const Table & table, std::string_view value, size_t hash) const noexcept {
+            for (auto i = hash & table.mask; ; i = (i + 1) & table.mask) {
+                auto slot = table.slots[i].load(std::memory_order_acquire);
+                if (!slot) {
+                    return std::nullopt;
+                }
+                
+                auto id = static_cast<SymbolId>(slot) - 1;
+                if ((slot & ~uint64_t(0xFFFFFFFF)) == tag(hash) && view(id) == value) {
+                    return id;
+                }
+            }
+        }
+        
+        static void place(Table & table, size_t hash, SymbolId id) noexcept {
+            auto i = hash & table.mask;
+            while (table.slots[i].load(std::memory_order_relaxed)) {
+                i = (i + 1) & table.mask;
+            }
+            table.slots[i].store(tag(hash) | (static_cast<uint64_t>(id) + 1), std::memory_order_release);
+        }
+        
+        const char * store(std::string_view value) {
+            if (!bump || value.size() > left) {
+                auto size = std::max(chunk_size, value.size());
+                chunks.push_back(std::make_unique<char[]>(size));
+                bump = chunks.back().get();
+                left = size;
+            }
+            
+            auto data = bump;
+            std::memcpy(bump, value.data(), value.size());
+            bump += value.size();
+            left -= value.size();
+            return data;
+        }
+        
+        // a table twice the size holding ids [0, size), published for readers
+        void grow(size_t size) {
+            auto grown = std::make_unique<Table>(2 * (tables.back()->mask + 1));
+            for (SymbolId id = 0; id < size; ++id) {
+                auto [segment, offset] = locate(id);
+                place(*grown, segments[segment].load(std::memory_order_relaxed)[offset].hash, id);
+            }
+            table.store(grown.get(), std::memory_order_release);
+            tables.push_back(std::move(grown));
+        }
+    public:
+        explicit SymbolTable(size_t expected = 1024): segments(), table(), count(0), mutex(), tables(), chunks(), bump(nullptr), left(0) {
+            size_t size = 16;
+            while (size < 2 * expected) {
+                size *= 2;
+            }
+            tables.push_back(std::make_unique<Table>(size));
+            table.store(tables.back().get(), std::memory_order_release);
+        }
+        
+        SymbolTable(const SymbolTable &) = delete;
+        SymbolTable & operator = (const SymbolTable &) = delete;
+        
+        ~SymbolTable() {
+            for (auto & segment : segments) {
+                delete[] segment.load(std::memory_order_relaxed);
+            }
+        }
+        
+        // the one every Move and MoveBatch interns into
+        static SymbolTable & global() {
+            static SymbolTable table (1 << 16);
+            return table;
+        }
+        
+        // The id of value, the same for equal strings, adding it if it's
+        // new; throws std::length_error once there are 2^32 - 1024 strings.
+        SymbolId intern(std::string_view value) {
+            auto hash = std::hash<std::string_view>()(value);
+            if (auto id = find(*table.load(std::memory_order_acquire), value, hash)) {
+                return *id;
+            }
+            
+            std::lock_guard lock (mutex);
+            // another writer may have added it in the meantime
+            if (auto id = find(*table.load(std::memory_order_relaxed), value, hash)) {
+                return *id;
+            }
+            
+            auto id = count.load(std::memory_order_relaxed);
+            if (id == capacity) {
+                throw std::length_error("symbol table is full");
+            }
+            
+            auto [segment, offset] = locate(id);
+            auto entries = segments[segment].load(std::memory_order_relaxed);
+            if (!entries) {
+                entries = new Entry[size_t(1) << (segment + base_bits)];
+                segments[segment].store(entries, std::memory_order_release);
+            }
+            entries[offset] = Entry { store(value), value.size(), hash };
+            count.store(id + 1, std::memory_order_release);
+            
+            auto & current = *table.load(std::memory_order_relaxed);
+            if (2 * (static_cast<size_t>(id) + 1) > current.mask + 1) {
+                grow(id + 1);
+            } else {
+                place(current, hash, id);
+            }
+            return id;
+        }
+        
+        // the id of value if it's been interned, without adding it
+        std::optional<SymbolId> find(std::string_view value) const noexcept {
+            return find(*table.load(std::memory_order_acquire), value, std::hash<std::string_view>()(value));
+        }
+        
+        // the string of an id intern() or find() returned
+        std::string_view view(SymbolId id) const noexcept {
+            auto [segment, offset] = locate(id);
+            auto & entry = segments[segment].load(std::memory_order_acquire)[offset];
+            return std::string_view(entry.data, entry.size);
+        }
+        
+        size_t size() const noexcept { return count.load(std::memory_order_acquire); }
+    };
+
+}
+}
+
+#endif /* SymbolTable_hpp */
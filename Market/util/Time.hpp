@@ -0,0 +1,90 @@
+//
+//  Time.hpp
+//  Market
+//
+//  Created by Blagovest on 15/12/20.
+//
+
+#ifndef Util_Time_hpp
+#define Util_Time_hpp
+
+#include <cstdint>
+#include <cstring>
+
+namespace mkt {
+namespace util {
+
+    // days since 1970-01-01 of a proleptic Gregorian date, without going
+    // through mktime and the time zone database (Howard Hinnant's algorithm)
+    constexpr int64_t days_from_civil(int64_t year, unsigned month, unsigned day) noexcept {
+        year -= month <= 2;
+        const int64_t era = (year >= 0 ? year : year - 399) / 400;
+        const auto year_of_era = static_cast<unsigned>(year - era * 400);
+        const unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        const unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+        return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+    }
+    
+    struct CivilDate {
+        int64_t year;
+        unsigned month;
+        unsigned day;
+    };
+
+    // the inverse of days_from_civil
+    constexpr CivilDate civil_from_days(int64_t days) noexcept {
+        days += 719468;
+        const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+        const auto day_of_era = static_cast<unsigned>(days - era * 146097);
+        const unsigned year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+        const unsigned day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+        const unsigned shifted_month = (5 * day_of_year + 2) / 153;
+        const unsigned day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+        const unsigned month = shifted_month < 10 ? shifted_month + 3 : shifted_month - 9;
+        return CivilDate { static_cast<int64_t>(year_of_era) + era * 400 + (month <= 2), month, day };
+    }
+
+    // value of n ASCII digits, no checks
+    constexpr unsigned digits(const char * data, unsigned n) noexcept {
+        unsigned value = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            value = 10 * value + static_cast<unsigned>(data[i] - '0');
+        }
+        return value;
+    }
+    
+    // whether the n characters at data are all digits
+    constexpr bool all_digits(const char * data, unsigned n) noexcept {
+        for (unsigned i = 0; i < n; ++i) {
+            if (data[i] < '0' || data[i] > '9') {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // days_from_civil of a YYYYMMDD, remembering the last date asked for
+    // since timestamps mostly come a day at a time. No checks either.
+    class CivilDayCache {
+        uint64_t key;
+        int64_t days;
+    public:
+        CivilDayCache() noexcept: key(~uint64_t()), days() {}
+        
+        int64_t operator () (const char * yyyymmdd) noexcept {
+            uint64_t date;
+            std::memcpy(&date, yyyymmdd, sizeof(date));
+            
+            if (date != key) {
+                key = date;
+                days = days_from_civil(digits(yyyymmdd, 4), digits(yyyymmdd + 4, 2), digits(yyyymmdd + 6, 2));
+            }
+            
+            return days;
+        }
+    };
+
+}
+}
+
+#endif /* Time_hpp */